@@ -31,6 +31,7 @@ public:
   static void JSExportInitialize();
   
   virtual void postInitialize(JSObject& js_object) override;
+  using Widget::postCallAsConstructor;
   virtual void postCallAsConstructor(const JSContext& js_context, const std::vector<JSValue>& arguments) override;
   
   JSValue js_get_name() const HAL_NOEXCEPT;
@@ -49,11 +49,17 @@ void OtherWidget::postInitialize(JSObject& js_object) {
   HAL_LOG_DEBUG("OtherWidget:: postInitialize ", this);
 }
 
-void OtherWidget::postCallAsConstructor(const JSContext& js_context, const std::vector<JSValue>& arguments) {
+void OtherWidget::postCallAsConstructor(const JSContext& js_context, const JSArguments& arguments) {
   HAL_LOG_DEBUG("OtherWidget:: postCallAsConstructor ", this);
+  get_object().SetProperty("constructor_argument_count", js_context.CreateNumber(static_cast<double>(arguments.size())));
+}
+
+JSValue OtherWidget::js_callAsFunction(const JSArguments& arguments, JSObject&) {
+  return get_context().CreateNumber(static_cast<double>(arguments.size()));
 }
 
 void OtherWidget::JSExportInitialize() {
   JSExport<OtherWidget>::SetClassVersion(1);
   JSExport<OtherWidget>::SetParent(JSExport<JSExportObject>::Class());
+  JSExport<OtherWidget>::AddCallAsFunctionCallback<&OtherWidget::js_callAsFunction>();
 }
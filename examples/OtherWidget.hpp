@@ -59,7 +59,12 @@ public:
   static void JSExportInitialize();
 	
   virtual void postInitialize(JSObject& js_object) override;
-  virtual void postCallAsConstructor(const JSContext& js_context, const std::vector<JSValue>& arguments) override;
+  using JSExportObject::postCallAsConstructor;
+  virtual void postCallAsConstructor(const JSContext& js_context, const JSArguments& arguments) override;
+  
+  // Calling an OtherWidget as a function returns the number of
+  // arguments it was called with.
+  JSValue js_callAsFunction(const JSArguments& arguments, JSObject& this_object);
 	
 private:
   
@@ -70,4 +75,12 @@ void swap(OtherWidget& first, OtherWidget& second) HAL_NOEXCEPT {
   first.swap(second);
 }
 
+// OtherWidget's native objects are allocated from a pool, as an
+// example of choosing an allocation policy for a JSExport class.
+namespace HAL {
+  template<>
+  struct JSExportAllocator<OtherWidget> : JSExportPoolAllocator<OtherWidget, 64> {
+  };
+}
+
 #endif // _HAL_EXAMPLES_OTHERWIDGET_HPP_
@@ -207,12 +207,13 @@ std::string Widget::sayHello() {
 
 void Widget::JSExportInitialize() {
   JSExport<Widget>::SetClassVersion(1);
-  JSExport<Widget>::AddValueProperty("name"       , std::mem_fn(&Widget::js_get_name)  , std::mem_fn(&Widget::js_set_name));
+  JSExport<Widget>::AddValueProperty<&Widget::js_get_name, &Widget::js_set_name>("name");
   JSExport<Widget>::AddValueProperty("number"     , std::mem_fn(&Widget::js_get_number), std::mem_fn(&Widget::js_set_number));
+  JSExport<Widget>::AddValueProperty<decltype(&Widget::number__), &Widget::number__>("rawNumber");
   JSExport<Widget>::AddValueProperty("value"     , std::mem_fn(&Widget::js_get_value), std::mem_fn(&Widget::js_set_value));
-  JSExport<Widget>::AddValueProperty("pi"         , std::mem_fn(&Widget::js_get_pi));
+  JSExport<Widget>::AddValueProperty<&Widget::js_get_pi>("pi");
   JSExport<Widget>::AddFunctionProperty("helloCallback", std::mem_fn(&Widget::js_helloLambda));
-  JSExport<Widget>::AddFunctionProperty("sayHello", std::mem_fn(&Widget::js_sayHello));
+  JSExport<Widget>::AddFunctionProperty<&Widget::js_sayHello>("sayHello");
   JSExport<Widget>::AddFunctionProperty("sayHelloWithCallback", std::mem_fn(&Widget::js_sayHelloWithCallback));
   JSExport<Widget>::AddFunctionProperty("testMemberObjectProperty", std::mem_fn(&Widget::js_testMemberObjectProperty));
   JSExport<Widget>::AddFunctionProperty("testMemberArrayProperty", std::mem_fn(&Widget::js_testMemberArrayProperty));
@@ -227,6 +228,10 @@ void Widget::JSExportInitialize() {
   JSExport<Widget>::AddFunctionProperty("testCallAsFunction", std::mem_fn(&Widget::js_testCallAsFunction));
   JSExport<Widget>::AddFunctionProperty("testException", std::mem_fn(&Widget::js_testException));
   JSExport<Widget>::AddFunctionProperty("testNestedException", std::mem_fn(&Widget::js_testNestedException));
+  JSExport<Widget>::AddFunctionProperty<decltype(&Widget::js_scaleNumber), &Widget::js_scaleNumber>("scaleNumber");
+  JSExport<Widget>::AddFunctionProperty<decltype(&Widget::js_greet), &Widget::js_greet>("greet");
+  JSExport<Widget>::AddFunctionProperty<decltype(&Widget::js_rename), &Widget::js_rename>("rename");
+  JSExport<Widget>::AddFunctionProperty<&Widget::js_sum>("sum");
 }
 
 JSValue Widget::js_get_name() const HAL_NOEXCEPT {
@@ -268,6 +273,25 @@ JSValue Widget::js_get_pi() const {
   return get_context().CreateNumber(get_pi());
 }
 
+double Widget::js_scaleNumber(double factor) const {
+  return number__ * factor;
+}
+
+std::string Widget::js_greet(const std::string& greeting, int32_t count) const {
+  std::string result;
+  for (int32_t i = 0; i < count; ++i) {
+    if (i > 0) {
+      result += ", ";
+    }
+    result += greeting + " " + name__;
+  }
+  return result;
+}
+
+void Widget::js_rename(const std::string& name) {
+  set_name(name);
+}
+
 JSValue Widget::js_sayHelloWithCallback(const std::vector<JSValue>& arguments, JSObject& this_object) {
   if (arguments.size() > 0) {
     if (arguments.at(0).IsObject()) {
@@ -355,4 +379,12 @@ JSValue Widget::js_testException(const std::vector<JSValue>& arguments, JSObject
 JSValue Widget::js_testNestedException(const std::vector<JSValue>& arguments, JSObject& this_object) {
   const auto js_context = this_object.get_context();
   return js_context.JSEvaluateScript("this.testException()", this_object, "app.js", 123);
-}
\ No newline at end of file
+}
+
+JSValue Widget::js_sum(const JSArguments& arguments, JSObject& this_object) {
+  double sum = 0;
+  for (const auto argument : arguments) {
+    sum += static_cast<double>(argument);
+  }
+  return this_object.get_context().CreateNumber(sum);
+}
@@ -73,6 +73,7 @@ public:
   static void JSExportInitialize();
 	
   virtual void postInitialize(JSObject& js_object) override;
+  using JSExportObject::postCallAsConstructor;
   virtual void postCallAsConstructor(const JSContext& js_context, const std::vector<JSValue>& arguments) override;
 	
   JSValue js_get_name() const              HAL_NOEXCEPT;
@@ -104,6 +105,12 @@ public:
   
   JSValue js_testException(const std::vector<JSValue>& arguments, JSObject& this_object);
   JSValue js_testNestedException(const std::vector<JSValue>& arguments, JSObject& this_object);
+  
+  double      js_scaleNumber(double factor) const;
+  std::string js_greet(const std::string& greeting, int32_t count) const;
+  void        js_rename(const std::string& name);
+  
+  JSValue js_sum(const JSArguments& arguments, JSObject& this_object);
 
   static uint32_t constructor_count__;
 private:
@@ -14,11 +14,19 @@
 
 #include "HAL/JSExport.hpp"
 #include "HAL/JSExportObject.hpp"
+#include "HAL/JSExportAllocator.hpp"
+#include "HAL/JSVectorView.hpp"
 #include "HAL/JSClass.hpp"
 
 #include "HAL/JSString.hpp"
+#include "HAL/JSStringView.hpp"
 
 #include "HAL/JSValue.hpp"
+#include "HAL/JSValueView.hpp"
+#include "HAL/JSArguments.hpp"
+#include "HAL/JSException.hpp"
+#include "HAL/JSResult.hpp"
+#include "HAL/JSONSink.hpp"
 #include "HAL/JSUndefined.hpp"
 #include "HAL/JSNull.hpp"
 #include "HAL/JSBoolean.hpp"
@@ -26,11 +34,17 @@
 
 #include "HAL/JSObject.hpp"
 #include "HAL/JSArray.hpp"
+#include "HAL/JSObjectTemplate.hpp"
+#include "HAL/JSIterable.hpp"
 #include "HAL/JSDate.hpp"
 #include "HAL/JSError.hpp"
 #include "HAL/JSFunction.hpp"
 #include "HAL/JSRegExp.hpp"
+#include "HAL/JSArrayBuffer.hpp"
+#include "HAL/JSTypedArray.hpp"
+#include "HAL/JSSharedBuffer.hpp"
 
 #include "HAL/JSPropertyNameArray.hpp"
+#include "HAL/JSWeakMap.hpp"
 
 #endif // _HAL_HPP_
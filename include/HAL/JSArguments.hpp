@@ -0,0 +1,195 @@
+/**
+ * HAL
+ *
+ * Copyright (c) 2014 by Appcelerator, Inc. All Rights Reserved.
+ * Licensed under the terms of the Apache Public License.
+ * Please see the LICENSE included with this distribution for details.
+ */
+
+#ifndef _HAL_JSARGUMENTS_HPP_
+#define _HAL_JSARGUMENTS_HPP_
+
+#include "HAL/detail/JSBase.hpp"
+#include "HAL/JSContext.hpp"
+#include "HAL/JSValueView.hpp"
+
+#include <cstddef>
+#include <iterator>
+#include <vector>
+
+namespace HAL {
+
+  class JSValue;
+
+  namespace detail {
+    template<typename T>
+    class JSExportClass;
+  }
+
+  /*!
+   @class
+
+   @discussion A JSArguments is a non-owning view of the arguments
+   that JavaScriptCore passes to a native function, e.g. one added by
+   JSExport::AddFunctionProperty.
+
+   Creating a JSArguments neither copies the argument array nor
+   protects each argument, and indexing it yields JSValueViews. It is
+   only valid for the duration of the call it was passed to. Convert
+   it, or the arguments you need, to JSValues to keep them for longer.
+
+   As in JavaScript, an argument at an index at or beyond size() is
+   undefined.
+   */
+  class HAL_EXPORT JSArguments final {
+
+  public:
+
+    /*!
+     @class
+
+     @discussion An iterator over the arguments that yields
+     JSValueViews.
+     */
+    class const_iterator final {
+
+    public:
+
+      typedef std::forward_iterator_tag iterator_category;
+      typedef JSValueView               value_type;
+      typedef std::ptrdiff_t            difference_type;
+      typedef const JSValueView*        pointer;
+      typedef JSValueView               reference;
+
+      JSValueView operator*() const HAL_NOEXCEPT {
+        return JSValueView(js_context_ref__, *js_value_ref_ptr__);
+      }
+
+      const_iterator& operator++() HAL_NOEXCEPT {
+        ++js_value_ref_ptr__;
+        return *this;
+      }
+
+      const_iterator operator++(int) HAL_NOEXCEPT {
+        const_iterator previous(*this);
+        ++js_value_ref_ptr__;
+        return previous;
+      }
+
+      bool operator==(const const_iterator& rhs) const HAL_NOEXCEPT {
+        return js_value_ref_ptr__ == rhs.js_value_ref_ptr__;
+      }
+
+      bool operator!=(const const_iterator& rhs) const HAL_NOEXCEPT {
+        return js_value_ref_ptr__ != rhs.js_value_ref_ptr__;
+      }
+
+    private:
+
+      friend JSArguments;
+
+      const_iterator(JSContextRef js_context_ref, const JSValueRef* js_value_ref_ptr) HAL_NOEXCEPT
+      : js_context_ref__(js_context_ref)
+      , js_value_ref_ptr__(js_value_ref_ptr) {
+      }
+
+      JSContextRef      js_context_ref__   { nullptr };
+      const JSValueRef* js_value_ref_ptr__ { nullptr };
+    };
+
+    /*!
+     @method
+
+     @abstract Return the execution context of the call.
+     */
+    JSContext get_context() const HAL_NOEXCEPT {
+      return JSContext(js_context_ref__);
+    }
+
+    /*!
+     @method
+
+     @abstract Return the number of arguments passed to the call.
+     */
+    std::size_t size() const HAL_NOEXCEPT {
+      return argument_count__;
+    }
+
+    bool empty() const HAL_NOEXCEPT {
+      return argument_count__ == 0;
+    }
+
+    /*!
+     @method
+
+     @abstract Return a view of the argument at index, which is
+     undefined if index is not less than size().
+     */
+    JSValueView operator[](std::size_t index) const HAL_NOEXCEPT {
+      return JSValueView(js_context_ref__, index < argument_count__ ? arguments_array__[index] : JSValueMakeUndefined(js_context_ref__));
+    }
+
+    /*!
+     @method
+
+     @abstract Convert the argument at index to a JSString, a
+     std::string, a bool, a double, an int32_t, a uint32_t, a JSValue
+     or a JSObject, with the same semantics as the corresponding
+     JSValueView conversions, like this:
+
+     const auto scale = arguments.Get<double>(0);
+
+     @throws std::runtime_error if the conversion threw a JavaScript
+     exception.
+     */
+    template<typename U>
+    U Get(std::size_t index) const {
+      return static_cast<U>(operator[](index));
+    }
+
+    /*!
+     @method
+
+     @abstract Return iterators over the arguments passed to the
+     call.
+     */
+    const_iterator begin() const HAL_NOEXCEPT {
+      return const_iterator(js_context_ref__, arguments_array__);
+    }
+
+    const_iterator end() const HAL_NOEXCEPT {
+      return const_iterator(js_context_ref__, arguments_array__ + argument_count__);
+    }
+
+    /*!
+     @method
+
+     @abstract Return an owning JSValue for each argument.
+     */
+    operator std::vector<JSValue>() const;
+
+  private:
+
+    // Only the JSExportClass static functions create a JSArguments.
+    template<typename T>
+    friend class detail::JSExportClass;
+
+    JSArguments(JSContextRef js_context_ref, std::size_t argument_count, const JSValueRef arguments_array[]) HAL_NOEXCEPT
+    : js_context_ref__(js_context_ref)
+    , argument_count__(argument_count)
+    , arguments_array__(arguments_array) {
+    }
+
+    // Silence 4251 on Windows since private member variables do not
+    // need to be exported from a DLL.
+#pragma warning(push)
+#pragma warning(disable: 4251)
+    JSContextRef      js_context_ref__   { nullptr };
+    std::size_t       argument_count__   { 0 };
+    const JSValueRef* arguments_array__  { nullptr };
+#pragma warning(pop)
+  };
+
+} // namespace HAL {
+
+#endif // _HAL_JSARGUMENTS_HPP_
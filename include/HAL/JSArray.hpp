@@ -12,8 +12,43 @@
 #include "HAL/JSObject.hpp"
 #include "HAL/JSValue.hpp"
 #include "HAL/JSString.hpp"
+#include "HAL/JSValueView.hpp"
+#include <cstddef>
+#include <iterator>
+#include <string>
+#include <type_traits>
 #include <vector>
 
+namespace HAL { namespace detail {
+
+	// How JSContext::CreateArray passes a native element to
+	// JSArray::MakeElement. Arithmetic types other than bool become
+	// JavaScript numbers, which are never garbage collected, and bool
+	// becomes a JavaScript boolean. The JSValueRefs of all other
+	// element types are protected until the Array holds them.
+	template<typename T, bool is_number = std::is_arithmetic<T>::value && !std::is_same<T, bool>::value>
+	struct JSArrayElementTraits {
+		typedef const T& argument_type;
+		static const bool is_protected = !std::is_same<T, bool>::value;
+	};
+
+	template<typename T>
+	struct JSArrayElementTraits<T, true> {
+		typedef double argument_type;
+		static const bool is_protected = false;
+	};
+
+	template<typename Iterator>
+	void ReserveForRange(std::vector<JSValueRef>&, Iterator, Iterator, std::input_iterator_tag) {
+	}
+
+	template<typename Iterator>
+	void ReserveForRange(std::vector<JSValueRef>& js_value_refs, Iterator first, Iterator last, std::forward_iterator_tag) {
+		js_value_refs.reserve(static_cast<std::size_t>(std::distance(first, last)));
+	}
+
+}} // namespace HAL { namespace detail {
+
 namespace HAL {
 
 /*!
@@ -45,6 +80,110 @@ public:
      */
     virtual uint32_t GetLength() const HAL_NOEXCEPT final;
 
+    /*!
+     @method
+     
+     @abstract Read the elements in the index range [begin, end) of
+     this JSArray.
+     
+     @discussion The range is clamped to the length of this JSArray.
+     values is cleared first, so the same vector can be reused across
+     calls without reallocating.
+     
+     @result The number of elements read.
+     
+     @throws std::runtime_error if reading an element threw a
+     JavaScript exception.
+     */
+    virtual uint32_t GetRange(uint32_t begin, uint32_t end, std::vector<JSValue>& values) const final;
+
+    /*!
+     @method
+     
+     @abstract Append elements to the end of this JSArray.
+     
+     @discussion The native element types accepted are the same as
+     for JSContext::CreateArray. The elements are converted directly to
+     JSValueRefs, without creating a JSValue per element, and the
+     length of this JSArray is only read once.
+     
+     @throws std::runtime_error if storing an element threw a
+     JavaScript exception.
+     */
+    virtual void Append(const std::vector<JSValue>& values) final;
+
+    template<typename Iterator>
+    void Append(Iterator first, Iterator last);
+
+    template<typename T>
+    void Append(const std::vector<T>& elements);
+
+    /*!
+     @class
+     
+     @discussion A forward iterator over the elements of a JSArray
+     that yields JSValueViews, so iterating doesn't protect each
+     element. An element is fetched each time the iterator is
+     dereferenced. The iterator is invalidated if the JSArray is
+     destroyed or modified.
+     */
+    class HAL_EXPORT const_iterator final {
+
+    public:
+
+        typedef std::forward_iterator_tag iterator_category;
+        typedef JSValueView               value_type;
+        typedef std::ptrdiff_t            difference_type;
+        typedef const JSValueView*        pointer;
+        typedef JSValueView               reference;
+
+        // Throws std::runtime_error if reading the element threw a
+        // JavaScript exception.
+        JSValueView operator*() const;
+
+        const_iterator& operator++() HAL_NOEXCEPT {
+            ++index__;
+            return *this;
+        }
+
+        const_iterator operator++(int) HAL_NOEXCEPT {
+            const_iterator previous(*this);
+            ++index__;
+            return previous;
+        }
+
+        bool operator==(const const_iterator& rhs) const HAL_NOEXCEPT {
+            return index__ == rhs.index__;
+        }
+
+        bool operator!=(const const_iterator& rhs) const HAL_NOEXCEPT {
+            return index__ != rhs.index__;
+        }
+
+    private:
+
+        friend JSArray;
+
+        const_iterator(const JSArray* js_array, JSContextRef js_context_ref, uint32_t index) HAL_NOEXCEPT
+        : js_array__(js_array)
+        , js_context_ref__(js_context_ref)
+        , index__(index) {
+        }
+
+        const JSArray* js_array__       { nullptr };
+        JSContextRef   js_context_ref__ { nullptr };
+        uint32_t       index__          { 0 };
+    };
+
+    /*!
+     @method
+     
+     @abstract Return iterators over the elements of this JSArray. The
+     length is read once, by end().
+     */
+    const_iterator begin() const HAL_NOEXCEPT;
+    const_iterator end() const HAL_NOEXCEPT;
+
     /*!
      @method
      
@@ -61,11 +200,39 @@ private:
 	// Only JSContext and JSObject can create a JSArray.
 	friend JSContext;
 	friend JSObject;
+	friend class JSObjectTemplate;
 	
 	JSArray(const JSContext& js_context, const std::vector<JSValue>& arguments = {});
 
 	static JSObjectRef MakeArray(const JSContext& js_context, const std::vector<JSValue>& arguments);
 
+	// Create an Array from js_value_refs with a single call to
+	// JavaScriptCore. If unprotect is true then every element is
+	// unprotected afterwards, even if an exception is thrown.
+	static JSObjectRef MakeArray(const JSContext& js_context, const std::vector<JSValueRef>& js_value_refs, bool unprotect);
+
+	// Convert a native element for MakeArray. The JSValueRef returned
+	// for anything other than a number or a bool is protected.
+	static JSValueRef MakeElement(const JSContext& js_context, double value) HAL_NOEXCEPT;
+	static JSValueRef MakeElement(const JSContext& js_context, bool value) HAL_NOEXCEPT;
+	static JSValueRef MakeElement(const JSContext& js_context, const char* value) HAL_NOEXCEPT;
+	static JSValueRef MakeElement(const JSContext& js_context, const std::string& value) HAL_NOEXCEPT;
+	static JSValueRef MakeElement(const JSContext& js_context, const JSString& value) HAL_NOEXCEPT;
+	static JSValueRef MakeElement(const JSContext& js_context, const JSValue& value) HAL_NOEXCEPT;
+	static JSValueRef MakeElement(const JSContext& js_context, const JSObject& value) HAL_NOEXCEPT;
+	static JSValueRef MakeElement(const JSContext& js_context, const JSValueView& value) HAL_NOEXCEPT;
+
+	static void UnprotectElements(const JSContext& js_context, const std::vector<JSValueRef>& js_value_refs) HAL_NOEXCEPT;
+
+	// Convert the range [first, last) with MakeElement.
+	template<typename Iterator>
+	static std::vector<JSValueRef> MakeElements(const JSContext& js_context, Iterator first, Iterator last);
+
+	// Store js_value_refs after the last element of this JSArray. If
+	// unprotect is true then every element is unprotected afterwards,
+	// even if an exception is thrown.
+	void AppendElements(const std::vector<JSValueRef>& js_value_refs, bool unprotect);
+
 	// For interoperability with the JavaScriptCore C API.
 	JSArray(const JSContext& js_context, JSObjectRef js_object_ref);
 };
@@ -86,6 +253,52 @@ std::vector<std::shared_ptr<T>> JSArray::GetPrivateItems() const HAL_NOEXCEPT {
 	return items;
 }
 
+template<typename Iterator>
+JSArray JSContext::CreateArray(Iterator first, Iterator last) const {
+	typedef typename std::remove_cv<typename std::iterator_traits<Iterator>::value_type>::type value_type;
+	const auto js_value_refs = JSArray::MakeElements(*this, first, last);
+	return JSArray(*this, JSArray::MakeArray(*this, js_value_refs, detail::JSArrayElementTraits<value_type>::is_protected));
+}
+
+template<typename T>
+JSArray JSContext::CreateArray(const std::vector<T>& elements) const {
+	return CreateArray(elements.begin(), elements.end());
+}
+
+template<typename Iterator>
+std::vector<JSValueRef> JSArray::MakeElements(const JSContext& js_context, Iterator first, Iterator last) {
+	typedef typename std::iterator_traits<Iterator> iterator_traits;
+	typedef typename std::remove_cv<typename iterator_traits::value_type>::type value_type;
+	typedef detail::JSArrayElementTraits<value_type> element_traits;
+
+	std::vector<JSValueRef> js_value_refs;
+	detail::ReserveForRange(js_value_refs, first, last, typename iterator_traits::iterator_category());
+	try {
+		for (; first != last; ++first) {
+			js_value_refs.push_back(MakeElement(js_context, static_cast<typename element_traits::argument_type>(*first)));
+		}
+	} catch (...) {
+		if (element_traits::is_protected) {
+			UnprotectElements(js_context, js_value_refs);
+		}
+		throw;
+	}
+
+	return js_value_refs;
+}
+
+template<typename Iterator>
+void JSArray::Append(Iterator first, Iterator last) {
+	typedef typename std::remove_cv<typename std::iterator_traits<Iterator>::value_type>::type value_type;
+	const auto js_context = get_context();
+	AppendElements(MakeElements(js_context, first, last), detail::JSArrayElementTraits<value_type>::is_protected);
+}
+
+template<typename T>
+void JSArray::Append(const std::vector<T>& elements) {
+	Append(elements.begin(), elements.end());
+}
+
 } // namespace HAL {
 
 #endif // _HAL_JSARRAY_HPP_
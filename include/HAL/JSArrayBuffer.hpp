@@ -0,0 +1,101 @@
+/**
+ * HAL
+ *
+ * Copyright (c) 2014 by Appcelerator, Inc. All Rights Reserved.
+ * Licensed under the terms of the Apache Public License.
+ * Please see the LICENSE included with this distribution for details.
+ */
+
+#ifndef _HAL_JSARRAYBUFFER_HPP_
+#define _HAL_JSARRAYBUFFER_HPP_
+
+#include "HAL/JSObject.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace HAL {
+
+  namespace detail {
+    class JSTypedArrayBase;
+  }
+
+  /*!
+   @class
+
+   @discussion A JavaScript object of the ArrayBuffer type.
+
+   A JSArrayBuffer gives C++ direct access to the bytes of the
+   ArrayBuffer through data() and size(), without copying them
+   element by element through JSValues.
+
+   The only way to create a JSArrayBuffer is by using the
+   JSContext::CreateArrayBuffer member functions, or by converting a
+   JSObject that is an ArrayBuffer.
+   */
+  class HAL_EXPORT JSArrayBuffer final : public JSObject HAL_PERFORMANCE_COUNTER2(JSArrayBuffer) {
+
+  public:
+
+    /*!
+     @method
+
+     @abstract Return a pointer to the first byte of this ArrayBuffer.
+
+     @discussion The pointer remains valid as long as this JSArrayBuffer
+     is alive, unless the ArrayBuffer is detached (e.g. transferred to a
+     worker) by JavaScript.
+
+     @result A pointer to the first byte of this ArrayBuffer, or
+     nullptr if it is empty or detached.
+     */
+    virtual std::uint8_t* data() const HAL_NOEXCEPT final;
+
+    /*!
+     @method
+
+     @abstract Return the number of bytes in this ArrayBuffer.
+     */
+    virtual std::size_t size() const HAL_NOEXCEPT final;
+
+    std::uint8_t* begin() const HAL_NOEXCEPT {
+      return data();
+    }
+
+    std::uint8_t* end() const HAL_NOEXCEPT {
+      return data() + size();
+    }
+
+    bool empty() const HAL_NOEXCEPT {
+      return size() == 0;
+    }
+
+  private:
+
+    // Only JSContext, JSObject and JSTypedArray can create a
+    // JSArrayBuffer.
+    friend JSContext;
+    friend JSObject;
+    friend detail::JSTypedArrayBase;
+
+    // Create an ArrayBuffer over native memory without copying it.
+    // deallocator is called with bytes once the ArrayBuffer is
+    // garbage collected.
+    JSArrayBuffer(const JSContext& js_context, void* bytes, std::size_t byte_length, JSBytesDeallocator deallocator);
+
+    // For interoperability with the JavaScriptCore C API.
+    //
+    // Throws std::invalid_argument if js_object_ref is not an
+    // ArrayBuffer.
+    JSArrayBuffer(const JSContext& js_context, JSObjectRef js_object_ref);
+
+    static JSObjectRef MakeArrayBuffer(const JSContext& js_context, void* bytes, std::size_t byte_length, JSBytesDeallocator deallocator);
+
+    // The JSTypedArrayBytesDeallocator given to JavaScriptCore. The
+    // deallocator_context is a heap allocated JSBytesDeallocator.
+    static void DeallocateBytes(void* bytes, void* deallocator_context);
+  };
+
+} // namespace HAL {
+
+#endif // _HAL_JSARRAYBUFFER_HPP_
@@ -43,6 +43,11 @@ namespace HAL {
    An instance of JSClass may be passed to the JSContextGroup
    constructor to create a custom JavaScript global object for all
    contexts in that group.
+   
+   A JSClass is a cheap handle: copying one only retains the
+   underlying JSClassRef, because class names are interned. JSClasses
+   created from equal definitions share a single JSClassRef, which is
+   kept in a process-wide registry and never released.
    */
   class HAL_EXPORT JSClass HAL_PERFORMANCE_COUNTER1(JSClass) {
   public:
@@ -56,6 +61,16 @@ namespace HAL {
      */
     JSClass() HAL_NOEXCEPT;
     
+    /*!
+     @method
+     
+     @abstract Return the process-wide empty JSClass, e.g. for creating
+     plain JavaScript objects, without creating or copying a JSClass.
+     
+     @result The empty JSClass.
+     */
+    static const JSClass& get_empty() HAL_NOEXCEPT;
+    
     /*!
      @method
      
@@ -73,7 +88,7 @@ namespace HAL {
      @result The name of this JSClass.
      */
     virtual std::string get_name() const HAL_NOEXCEPT final {
-      return name__;
+      return *name__;
     }
     
     virtual ~JSClass()          HAL_NOEXCEPT;
@@ -101,22 +116,34 @@ namespace HAL {
       return js_class_ref__;
     }
     
+    // Return the interned copy of name, which lives as long as the
+    // process.
+    static const std::string* InternName(const std::string& name);
+    
+    // Return a retained JSClassRef for the definition, creating it
+    // only if no equal definition has been registered before.
+    static JSClassRef AcquireClassRef(const std::string& name, const ::JSClassDefinition& js_class_definition);
+    
     // Silence 4251 on Windows since private member variables do not
     // need to be exported from a DLL.
 #pragma warning(push)
 #pragma warning(disable: 4251)
-    std::string name__;
-    JSClassRef  js_class_ref__ { nullptr };
+    const std::string* name__        { nullptr };
+    JSClassRef         js_class_ref__ { nullptr };
 #pragma warning(pop)
     
   protected:
     
 #undef  HAL_JSCLASS_LOCK_GUARD
+#undef  HAL_JSCLASS_LOCK_GUARD_STATIC
 #ifdef  HAL_THREAD_SAFE
-    std::recursive_mutex mutex__;
+           std::recursive_mutex mutex__;
+    static std::recursive_mutex mutex_static__;
 #define HAL_JSCLASS_LOCK_GUARD std::lock_guard<std::recursive_mutex> lock(mutex__)
+#define HAL_JSCLASS_LOCK_GUARD_STATIC std::lock_guard<std::recursive_mutex> lock_static(JSClass::mutex_static__)
 #else
 #define HAL_JSCLASS_LOCK_GUARD
+#define HAL_JSCLASS_LOCK_GUARD_STATIC
 #endif  // HAL_THREAD_SAFE
   };
   
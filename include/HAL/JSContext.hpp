@@ -11,7 +11,12 @@
 
 #include "HAL/detail/JSBase.hpp"
 #include "HAL/JSContextGroup.hpp"
+#include "HAL/detail/JSContextData.hpp"
 
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
 #include <vector>
 #include <unordered_map>
 
@@ -26,21 +31,57 @@ namespace HAL {
   class JSNumber;
   class JSObject;
   class JSArray;
+  class JSObjectTemplate;
   class JSDate;
   class JSError;
   class JSRegExp;
   class JSFunction;
   class JSExportObject;
+  class JSException;
+  class JSArrayBuffer;
+  class JSValueView;
+  class JSArguments;
+  class JSSharedBuffer;
+  
+  template<typename T>
+  class JSTypedArray;
+  
+  template<typename T>
+  class JSResult;
   
   namespace detail {
     template<typename T>
     class JSExportClass;
     
+    class JSWeakMapBase;
+    class JSTypedArrayBase;
+    struct JSContextBuiltins;
+    
     HAL_EXPORT std::vector<JSValue> to_vector(const JSContext&, size_t, const JSValueRef[]);
   }}
 
 namespace HAL {
   
+  /*!
+   @typedef
+   
+   @abstract A callback that releases native memory handed to
+   JavaScript without copying, e.g. by JSContext::CreateArrayBuffer.
+   It is called with the pointer to the memory once the JavaScript
+   object that uses it has been garbage collected.
+   */
+  typedef std::function<void(void* bytes)> JSBytesDeallocator;
+  
+  /*!
+   @typedef
+   
+   @abstract A callback that produces the elements of a JavaScript
+   iterable on demand, e.g. for JSContext::CreateIterable. It returns
+   an Array holding at most max_count next elements, and an empty
+   Array once there are no more elements.
+   */
+  typedef std::function<JSArray(const JSContext& js_context, std::size_t max_count)> JSIterableCallback;
+  
   /*!
    @class
    
@@ -194,6 +235,97 @@ namespace HAL {
      */
     JSNumber CreateNumber(uint32_t number) const HAL_NOEXCEPT;
     
+    
+    /* Preallocated Values */
+    
+    /*!
+     @method
+     
+     @abstract Return this execution context's preallocated value of
+     the undefined type.
+     
+     @discussion The undefined, null, true and false values and the
+     small integers (see SetCachedNumberRange) are created once per
+     execution context and shared by every JSContext that refers to
+     it, so returning one of them by const reference makes no
+     JavaScriptCore calls. The reference stays valid for as long as
+     this JSContext (or any copy of it) is alive.
+     
+     CreateUndefined, CreateNull, CreateBoolean and
+     CreateNumber(int32_t|uint32_t) return copies of these values.
+     
+     @result The unique undefined value.
+     */
+    const JSUndefined& get_undefined() const HAL_NOEXCEPT;
+    
+    /*!
+     @method
+     
+     @abstract Return this execution context's preallocated value of
+     the null type.
+     
+     @result The unique null value.
+     */
+    const JSNull& get_null() const HAL_NOEXCEPT;
+    
+    /*!
+     @method
+     
+     @abstract Return this execution context's preallocated true or
+     false value.
+     
+     @param boolean The value to return.
+     
+     @result The preallocated JavaScript value representing boolean.
+     */
+    const JSBoolean& get_boolean(bool boolean) const HAL_NOEXCEPT;
+    
+    /*!
+     @method
+     
+     @abstract Return this execution context's preallocated value of
+     a small integer.
+     
+     @param number An integer within this execution context's cached
+     number range.
+     
+     @result The preallocated JavaScript value representing number.
+     
+     @throws std::invalid_argument if number is outside of this
+     execution context's cached number range.
+     */
+    const JSNumber& get_number(std::int32_t number) const;
+    
+    /*!
+     @method
+     
+     @abstract Determine whether get_number may be called with the
+     given integer.
+     
+     @param number The integer to test.
+     
+     @result true if number is within this execution context's cached
+     number range.
+     */
+    bool IsCachedNumber(std::int32_t number) const HAL_NOEXCEPT;
+    
+    /*!
+     @method
+     
+     @abstract Set the range of integers that are preallocated per
+     execution context. The default range is [-1, 255].
+     
+     @discussion Each execution context creates its small integers the
+     first time one of them is asked for, using the range in effect at
+     that moment. Pass a first greater than last to disable the
+     integer cache.
+     
+     @param first The smallest cached integer.
+     
+     @param last The largest cached integer.
+     */
+    static void SetCachedNumberRange(std::int32_t first, std::int32_t last) HAL_NOEXCEPT;
+    
     /*!
      @method
      
@@ -231,6 +363,86 @@ namespace HAL {
      */
     JSArray CreateArray() const HAL_NOEXCEPT;
     JSArray CreateArray(const std::vector<JSValue>& arguments) const;
+
+    /*!
+     @method
+     
+     @abstract Create a JavaScript Array object from a range of native
+     values.
+     
+     @discussion The elements may be any arithmetic type (stored as
+     JavaScript numbers), bool, std::string, const char* or JSString.
+     Each element is converted directly to a JSValueRef and the Array
+     is created with a single call to JavaScriptCore, so no JSValue is
+     created per element. Include "HAL/JSArray.hpp" to use these
+     member functions.
+     
+     @param first The beginning of the range of elements.
+     
+     @param last The end of the range of elements.
+     
+     @result A JavaScript object that is an Array, populated with the
+     given elements.
+     */
+    template<typename Iterator>
+    JSArray CreateArray(Iterator first, Iterator last) const;
+    
+    template<typename T>
+    JSArray CreateArray(const std::vector<T>& elements) const;
+    
+    /*!
+     @method
+     
+     @abstract Create a template for JavaScript objects that all have
+     the given property names, in order.
+     
+     @discussion Use a JSObjectTemplate when creating many objects
+     with the same property names, e.g. one per row of a result set.
+     Create it once per execution context and reuse it. Include
+     "HAL/JSObjectTemplate.hpp" to use the result.
+     
+     @param property_names The property names of the objects created
+     by the template.
+     
+     @result A JSObjectTemplate.
+     */
+    JSObjectTemplate CreateObjectTemplate(const std::vector<JSString>& property_names) const;
+    
+    /*!
+     @method
+     
+     @abstract Create a JavaScript iterator whose elements are pulled
+     from native code on demand.
+     
+     @discussion The returned object has a next() method and is
+     iterable, so scripts can use it in for...of loops where the
+     engine supports them. Elements are requested from callback
+     chunk_size at a time, only when the script has consumed the
+     previous chunk, so at most one chunk is alive in JavaScript at
+     once no matter how long the sequence is. A larger chunk_size
+     crosses from JavaScript into native code less often.
+     
+     The callback is released once it returns an empty Array. It is
+     called on the thread that is running the script.
+     
+     The range overload reads the native elements lazily, converting
+     them like CreateArray(Iterator, Iterator) does. The range must be
+     at least a forward range, and must outlive the iteration. Include
+     "HAL/JSIterable.hpp" to use it.
+     
+     @param callback The callback that produces the elements.
+     
+     @param chunk_size The maximum number of elements to request from
+     callback at a time.
+     
+     @result A JavaScript iterator object.
+     
+     @throws std::invalid_argument if chunk_size is 0.
+     */
+    JSObject CreateIterable(JSIterableCallback callback, std::size_t chunk_size = 1) const;
+    
+    template<typename Iterator>
+    JSObject CreateIterable(Iterator first, Iterator last, std::size_t chunk_size = 64) const;
     
     /*!
      @method
@@ -260,6 +472,114 @@ namespace HAL {
     JSError CreateError() const HAL_NOEXCEPT;
     JSError CreateError(const std::vector<JSValue>& arguments) const;
     
+    /*!
+     @method
+     
+     @abstract Create a JavaScript ArrayBuffer object.
+     
+     @discussion The first form creates an ArrayBuffer of byte_length
+     zero bytes owned by JavaScript. The second form wraps native
+     memory without copying it: the ArrayBuffer uses bytes directly,
+     and deallocator is called with bytes once the ArrayBuffer has been
+     garbage collected. If creating the ArrayBuffer throws, the
+     deallocator is not called and the caller keeps ownership of
+     bytes.
+     
+     @result A JSArrayBuffer. Include "HAL/JSArrayBuffer.hpp" to use
+     it.
+     
+     @throws std::runtime_error if JavaScriptCore could not create the
+     ArrayBuffer.
+     */
+    JSArrayBuffer CreateArrayBuffer(std::size_t byte_length) const;
+    JSArrayBuffer CreateArrayBuffer(void* bytes, std::size_t byte_length, JSBytesDeallocator deallocator) const;
+    
+    /*!
+     @method
+     
+     @abstract Create a JavaScript ArrayBuffer over the memory of a
+     JSSharedBuffer without copying it.
+     
+     @discussion The ArrayBuffer holds a reference to the shared
+     memory until it is garbage collected, so the same JSSharedBuffer
+     may be surfaced in any number of contexts and context groups.
+     
+     @result A JSArrayBuffer. Include "HAL/JSArrayBuffer.hpp" to use
+     it.
+     */
+    JSArrayBuffer CreateArrayBuffer(const JSSharedBuffer& js_shared_buffer) const;
+    
+    /*!
+     @method
+     
+     @abstract Memory map a file and return a JavaScript ArrayBuffer
+     over the mapping, without reading or copying the file.
+     
+     @discussion The OS pages the file in as the ArrayBuffer is
+     accessed. The mapping is copy-on-write: scripts may write to the
+     ArrayBuffer, but the file is never modified. The file is unmapped
+     when the ArrayBuffer is garbage collected.
+     
+     Use CreateTypedArray<T>(js_array_buffer, byte_offset, length), or
+     CreateTypedArrayFromFile<T>, for a typed view of the file.
+     
+     @param path The path of the file to map.
+     
+     @result A JSArrayBuffer over the file. Include
+     "HAL/JSArrayBuffer.hpp" to use it.
+     
+     @throws std::runtime_error if the file can't be opened or mapped.
+     */
+    JSArrayBuffer CreateArrayBufferFromFile(const std::string& path) const;
+    
+    /*!
+     @method
+     
+     @abstract Memory map a file and return a typed array of element
+     type T over the whole mapping, see CreateArrayBufferFromFile.
+     
+     @throws std::runtime_error if the file can't be opened or mapped,
+     or if its size is not a multiple of sizeof(T).
+     */
+    template<typename T>
+    JSTypedArray<T> CreateTypedArrayFromFile(const std::string& path) const;
+    
+    /*!
+     @method
+     
+     @abstract Create a JavaScript typed array whose elements have the
+     C++ type T, e.g. CreateTypedArray<float> creates a Float32Array.
+     
+     @discussion The forms are:
+     
+     CreateTypedArray<T>(length) creates length zero elements owned by
+     JavaScript.
+     
+     CreateTypedArray<T>(elements, length, deallocator) wraps length
+     native elements without copying them, like CreateArrayBuffer.
+     
+     CreateTypedArray(std::vector<T>) takes over the vector's storage
+     without copying the elements.
+     
+     CreateTypedArray<T>(js_array_buffer, byte_offset, length) creates
+     a view of length elements of an existing ArrayBuffer.
+     
+     @result A JSTypedArray<T>. Include "HAL/JSTypedArray.hpp" to use
+     these member functions.
+     
+     @throws std::runtime_error if JavaScriptCore could not create the
+     typed array, e.g. because byte_offset is not a multiple of
+     sizeof(T).
+     */
+    template<typename T>
+    JSTypedArray<T> CreateTypedArray(std::size_t length) const;
+    template<typename T>
+    JSTypedArray<T> CreateTypedArray(T* elements, std::size_t length, JSBytesDeallocator deallocator) const;
+    template<typename T>
+    JSTypedArray<T> CreateTypedArray(std::vector<T> elements) const;
+    template<typename T>
+    JSTypedArray<T> CreateTypedArray(const JSArrayBuffer& js_array_buffer, std::size_t byte_offset, std::size_t length) const;
+    
     /*!
      @method
      
@@ -347,6 +667,20 @@ namespace HAL {
     JSValue JSEvaluateScript(const JSString& script,                       const JSString& source_url, int starting_line_number = 1) const;
     JSValue JSEvaluateScript(const JSString& script, JSObject this_object, const JSString& source_url, int starting_line_number = 1) const;
     
+    /*!
+     @method
+     
+     @abstract Evaluate a string of JavaScript code without throwing.
+     
+     @discussion The parameters are the same as for JSEvaluateScript.
+     Include "HAL/JSResult.hpp" to use the result.
+     
+     @result A JSResult holding either the value that the script
+     returns or the JSException describing the exception it threw.
+     */
+    JSResult<JSValue> TryJSEvaluateScript(const JSString& script                                                                                ) const HAL_NOEXCEPT;
+    JSResult<JSValue> TryJSEvaluateScript(const JSString& script, JSObject this_object, const JSString& source_url, int starting_line_number = 1) const HAL_NOEXCEPT;
+    
     /*!
      @method
      
@@ -435,24 +769,41 @@ namespace HAL {
     friend class JSRegExp;
     friend class JSFunction;
     friend class JSPropertyNameArray;
+    friend class detail::JSWeakMapBase;
+    friend class JSArrayBuffer;
+    friend class detail::JSTypedArrayBase;
+    friend class JSObjectTemplate;
     
     HAL_EXPORT friend bool operator==(const JSValue& lhs, const JSValue& rhs) HAL_NOEXCEPT;
     HAL_EXPORT friend std::vector<JSValue> detail::to_vector(const JSContext&, size_t, const JSValueRef[]);
     
     // For interoperability with the JavaScriptCore C API.
     explicit operator JSContextRef() const HAL_NOEXCEPT {
-      return js_global_context_ref__;
+      return js_context_data__ -> get_global_context_ref();
     }
     
-    // Only the JSExportClass static functions create a
-    // JSContext using the following constructor.
+    // Only the JSExportClass static functions, JSValueView and
+    // JSArguments create a JSContext using the following constructor.
     template<typename T>
     friend class detail::JSExportClass;
+    friend class JSValueView;
+    friend class JSArguments;
     
     explicit JSContext(JSContextRef js_context_ref) HAL_NOEXCEPT;
     
     // For interoperability with the JavaScriptCore C API.
-    explicit JSContext(JSGlobalContextRef js_global_context_ref__) HAL_NOEXCEPT;
+    explicit JSContext(JSGlobalContextRef js_global_context_ref) HAL_NOEXCEPT;
+    
+    // JSExportClass and JSObject use the following constructors for
+    // the execution context of a JavaScriptCore callback, which
+    // outlives the callback. A borrowed JSContext takes no reference
+    // to its JSContextData and doesn't retain its JSContextGroup, and
+    // borrowing an existing JSContext doesn't even look up the
+    // JSContextData. A copy or move of a borrowed JSContext is an
+    // ordinary JSContext.
+    struct BorrowedTag {};
+    JSContext(JSContextRef js_context_ref, BorrowedTag) HAL_NOEXCEPT;
+    JSContext(const JSContext& js_context, BorrowedTag) HAL_NOEXCEPT;
     
     // Prevent heap based objects.
     static void * operator new(std::size_t);       // #1: To prevent allocation of scalar objects
@@ -460,20 +811,50 @@ namespace HAL {
     
     HAL_EXPORT friend bool operator==(const JSContext& lhs, const JSContext& rhs);
     
+    // Return the JSContextData for js_global_context_ref, creating it
+    // if necessary, with one more reference.
+    static detail::JSContextData* AcquireContextData(JSGlobalContextRef js_global_context_ref) HAL_NOEXCEPT;
+    static void                   RetainContextData(detail::JSContextData* js_context_data)     HAL_NOEXCEPT;
+    static void                   ReleaseContextData(detail::JSContextData* js_context_data)    HAL_NOEXCEPT;
+    
+    // Return the JSContextData for js_global_context_ref without
+    // taking a reference, or nullptr if there isn't one.
+    static detail::JSContextData* FindContextData(JSGlobalContextRef js_global_context_ref)    HAL_NOEXCEPT;
+    
+    detail::JSContextValueCache& GetValueCache() const HAL_NOEXCEPT;
+    detail::JSContextValueCache& GetValueCacheWithNumbers() const HAL_NOEXCEPT;
+    
+    // Return the cached global object and builtins, looking them up
+    // the first time.
+    const detail::JSContextBuiltins& GetBuiltins() const HAL_NOEXCEPT;
+    
+    // Return the cached function that creates the JavaScript half of
+    // an iterable, compiling it the first time.
+    JSObject& GetIteratorFactory() const;
+    
     // Silence 4251 on Windows since private member variables do not
     // need to be exported from a DLL.
 #pragma warning(push)
 #pragma warning(disable: 4251)
-    JSContextGroup     js_context_group__;
-    JSGlobalContextRef js_global_context_ref__ { nullptr };
+    JSContextGroup         js_context_group__;
+    detail::JSContextData* js_context_data__ { nullptr };
+    bool                   borrowed__        { false };
+    static std::unordered_map<std::intptr_t, detail::JSContextData*> js_global_context_ref_to_context_data_map__;
 #pragma warning(pop)
     
+    static std::int32_t cached_number_first__;
+    static std::int32_t cached_number_last__;
+    
 #undef  HAL_JSCONTEXT_LOCK_GUARD
+#undef  HAL_JSCONTEXT_LOCK_GUARD_STATIC
 #ifdef  HAL_THREAD_SAFE
-    std::recursive_mutex mutex__;
+           std::recursive_mutex mutex__;
+    static std::recursive_mutex mutex_static__;
 #define HAL_JSCONTEXT_LOCK_GUARD std::lock_guard<std::recursive_mutex> lock(mutex__)
+#define HAL_JSCONTEXT_LOCK_GUARD_STATIC std::lock_guard<std::recursive_mutex> lock_static(JSContext::mutex_static__)
 #else
 #define HAL_JSCONTEXT_LOCK_GUARD
+#define HAL_JSCONTEXT_LOCK_GUARD_STATIC
 #endif  // HAL_THREAD_SAFE
   };
   
@@ -485,7 +866,7 @@ namespace HAL {
   // Return true if the two JSContexts are equal.
   inline
   bool operator==(const JSContext& lhs, const JSContext& rhs) {
-    return (lhs.js_global_context_ref__ == rhs.js_global_context_ref__);
+    return (lhs.js_context_data__ == rhs.js_context_data__);
   }
   
   // Return true if the two JSContextGroups are not equal.
@@ -88,6 +88,12 @@ namespace HAL {
     // For interoperability with the JavaScriptCore C API.
     explicit JSContextGroup(JSContextGroupRef js_context_group_ref) HAL_NOEXCEPT;
     
+    // A borrowed JSContextGroup neither retains nor releases its
+    // JSContextGroupRef. Only JSContext uses it, for a borrowed
+    // JSContext. A copy or move of it retains as usual.
+    struct BorrowedTag {};
+    JSContextGroup(JSContextGroupRef js_context_group_ref, BorrowedTag) HAL_NOEXCEPT;
+    
     // JSContext needs access to operator JSContextGroupRef().
     friend class JSContext;
     
@@ -106,6 +112,7 @@ namespace HAL {
 #pragma warning(push)
 #pragma warning(disable: 4251)
     JSContextGroupRef js_context_group_ref__;
+    bool              borrowed__ { false };
 #pragma warning(pop)
     
 #undef HAL_JSCONTEXTGROUP_LOCK_GUARD
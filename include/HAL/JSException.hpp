@@ -0,0 +1,117 @@
+/**
+ * HAL
+ *
+ * Copyright (c) 2014 by Appcelerator, Inc. All Rights Reserved.
+ * Licensed under the terms of the Apache Public License.
+ * Please see the LICENSE included with this distribution for details.
+ */
+
+#ifndef _HAL_JSEXCEPTION_HPP_
+#define _HAL_JSEXCEPTION_HPP_
+
+#include "HAL/detail/JSBase.hpp"
+#include "HAL/JSValue.hpp"
+
+#include <string>
+
+namespace HAL {
+
+  /*!
+   @class
+
+   @discussion A JSException is the error half of a JSResult: a
+   lightweight handle to the JavaScript value that was thrown by a
+   Try* member function, or to a native error message when the
+   operation failed before reaching JavaScript (e.g. calling an object
+   that is not a function).
+
+   Creating a JSException never touches the thrown value. Its
+   properties (name, message, stack, ...) are only read when the caller
+   asks for them, e.g. by calling message() or Throw().
+   */
+  class HAL_EXPORT JSException final HAL_PERFORMANCE_COUNTER1(JSException) {
+
+  public:
+
+    /*!
+     @method
+
+     @abstract Return the JavaScript value that was thrown.
+
+     @result The JavaScript value that was thrown, or JSUndefined if
+     the error did not originate in JavaScript.
+     */
+    JSValue get_value() const HAL_NOEXCEPT {
+      return js_value__;
+    }
+
+    /*!
+     @method
+
+     @abstract Determine whether this error originated in native code
+     rather than in a JavaScript exception.
+     */
+    bool IsNative() const HAL_NOEXCEPT {
+      return native_message__ != nullptr;
+    }
+
+    /*!
+     @method
+
+     @abstract Return a description of this error.
+
+     @discussion For JavaScript exceptions this converts the thrown
+     value to a string (e.g. "TypeError: foo is not a function"),
+     which may run JavaScript code. If that conversion itself throws
+     then "Unknown JavaScript exception" is returned.
+     */
+    std::string message() const HAL_NOEXCEPT;
+
+    /*!
+     @method
+
+     @abstract Throw this error as the corresponding throwing member
+     function would have done.
+
+     @throws std::runtime_error or one of its subclasses, always.
+     */
+    void Throw() const;
+
+    ~JSException()                               = default;
+    JSException(const JSException&)              = default;
+    JSException& operator=(const JSException&)   = default;
+
+#ifdef HAL_MOVE_CTOR_AND_ASSIGN_DEFAULT_ENABLE
+    JSException(JSException&&)                   = default;
+    JSException& operator=(JSException&&)        = default;
+#endif
+
+  private:
+
+    friend class JSValue;
+    friend class JSObject;
+    friend class JSContext;
+
+    // A JavaScript exception thrown while running the operation of
+    // internal_component_name.
+    JSException(const char* internal_component_name, const JSValue& js_value, const std::string& source_url = "", int line_number = 0) HAL_NOEXCEPT;
+
+    // An error detected by native code before reaching JavaScript.
+    // The message must be a string literal.
+    JSException(const char* internal_component_name, const JSContext& js_context, const char* native_message) HAL_NOEXCEPT;
+
+    // Silence 4251 on Windows since private member variables do not
+    // need to be exported from a DLL.
+#pragma warning(push)
+#pragma warning(disable: 4251)
+    const char* internal_component_name__;
+    JSValue     js_value__;
+    const char* native_message__ { nullptr };
+    std::string source_url__;
+    int         line_number__    { 0 };
+#pragma warning(pop)
+  };
+
+} // namespace HAL {
+
+#endif // _HAL_JSEXCEPTION_HPP_
@@ -114,8 +114,12 @@ namespace HAL {
      @method
      
      @abstract Return the JSClass for the C++ class T.
+     
+     @discussion The JSClass is created the first time this is called
+     and lives as long as the process, so the reference may be passed
+     to e.g. JSContext::CreateObject without copying it.
      */
-    static detail::JSExportClass<T> Class();
+    static const detail::JSExportClass<T>& Class();
     
     virtual ~JSExport() HAL_NOEXCEPT {
     }
@@ -251,6 +255,94 @@ namespace HAL {
      */
     static void AddFunctionProperty(const JSString& function_name, detail::CallNamedFunctionCallback<T> function_callback, bool enumerable = true);
     
+    /*!
+     @method
+     
+     @abstract Add a value or function property implemented by member
+     functions of T that are known at compile time.
+     
+     @discussion JavaScriptCore calls a thunk instantiated for each
+     member function directly, which avoids the property name lookup
+     and std::function call of the overloads that take callbacks. Use
+     these for hot properties, like this:
+     
+     AddValueProperty<&Foo::GetName, &Foo::SetName>("name");
+     AddValueProperty<&Foo::GetName>("name");
+     AddFunctionProperty<&Foo::Hello>("hello");
+     
+     The member functions must be declared in T itself, not in a base
+     class of T. The preconditions are the same as for the overloads
+     that take callbacks.
+     */
+    template<JSValue (T::*Getter)() const>
+    static void AddValueProperty(const JSString& property_name, bool enumerable = true) {
+      builder__.template AddValueProperty<Getter>(property_name, enumerable);
+    }
+    
+    template<JSValue (T::*Getter)() const, bool (T::*Setter)(const JSValue&)>
+    static void AddValueProperty(const JSString& property_name, bool enumerable = true) {
+      builder__.template AddValueProperty<Getter, Setter>(property_name, enumerable);
+    }
+    
+    /*!
+     @method
+     
+     @abstract Add a value property that reads and writes a data
+     member of T directly, like this:
+     
+     AddValueProperty<decltype(&Foo::ratio), &Foo::ratio>("ratio");
+     
+     @discussion No getter or setter needs to be written. A const data
+     member is read-only. See
+     JSExportClassDefinitionBuilder::AddValueProperty for the
+     supported data member types.
+     */
+    template<typename F, F Field>
+    static void AddValueProperty(const JSString& property_name, bool enumerable = true) {
+      builder__.template AddValueProperty<F, Field>(property_name, enumerable);
+    }
+    
+    template<JSValue (T::*Method)(const std::vector<JSValue>&, JSObject&)>
+    static void AddFunctionProperty(const JSString& function_name, bool enumerable = true) {
+      builder__.template AddFunctionProperty<Method>(function_name, enumerable);
+    }
+    
+    /*!
+     @method
+     
+     @abstract Add a function property implemented by a member
+     function that receives its arguments as a JSArguments view
+     instead of a std::vector<JSValue>, like this:
+     
+     AddFunctionProperty<&Foo::Sum>("sum");
+     
+     @discussion Use this for hot functions. Convert the arguments to
+     JSValues only if the member function needs to keep them.
+     */
+    template<JSValue (T::*Method)(const JSArguments&, JSObject&)>
+    static void AddFunctionProperty(const JSString& function_name, bool enumerable = true) {
+      builder__.template AddFunctionProperty<Method>(function_name, enumerable);
+    }
+    
+    /*!
+     @method
+     
+     @abstract Add a function property implemented by a member
+     function with a natural C++ signature, like this:
+     
+     AddFunctionProperty<decltype(&Foo::Scale), &Foo::Scale>("scale");
+     
+     @discussion The argument conversions, the arity check and the
+     result conversion are generated at compile time and work
+     directly on the JavaScriptCore argument array. See
+     JSExportClassDefinitionBuilder::AddFunctionProperty for the
+     supported argument and result types.
+     */
+    template<typename F, F Method>
+    static void AddFunctionProperty(const JSString& function_name, bool enumerable = true) {
+      builder__.template AddFunctionProperty<F, Method>(function_name, enumerable);
+    }
+    
     /*!
      @method
      
@@ -465,6 +557,32 @@ namespace HAL {
      */
     static void AddCallAsFunctionCallback(const detail::CallAsFunctionCallback<T>& call_as_function_callback);
     
+    /*!
+     @method
+     
+     @abstract Set a member function that takes its arguments as a
+     JSArguments to invoke when your JavaScript object is called as a
+     function.
+     
+     @discussion For example, given this class definition:
+     
+     class Foo {
+     JSValue DoSomething(const JSArguments& arguments, JSObject& this_object);
+     };
+     
+     You would call AddCallAsFunctionCallback like this:
+     
+     AddCallAsFunctionCallback<&Foo::DoSomething>();
+     
+     Calling your JavaScript object neither copies the arguments into
+     a std::vector nor goes through a std::function. See
+     JSArguments for how long the arguments may be used.
+     */
+    template<JSValue (T::*Method)(const JSArguments&, JSObject&)>
+    static void AddCallAsFunctionCallback() {
+      builder__.template CallAsFunction<Method>();
+    }
+    
     /*!
      @method
      
@@ -500,6 +618,84 @@ namespace HAL {
      */
     static void AddConvertToTypeCallback(const detail::ConvertToTypeCallback<T>& convert_to_type_callback);
     
+    /*!
+     @method
+     
+     @abstract Set the callback to invoke when getting an array index
+     property (e.g. obj[0]) from your JavaScript object.
+     
+     @discussion The index is parsed from the property name without
+     converting it to a std::string, so this is cheaper than parsing
+     the index in a GetPropertyCallback. Property names that are not
+     array indexes, and indexes for which this callback returns native
+     null value (context.CreateNativeNull()), go to your
+     GetPropertyCallback (if any), then your JavaScript object's
+     prototype chain.
+     
+     For example, given this class definition:
+     
+     class Foo {
+     JSValue GetElement(unsigned index) const;
+     };
+     
+     You would call AddIndexedGetCallback like this:
+     
+     AddIndexedGetCallback(&Foo::GetElement);
+     
+     @param get_indexed_property_callback The callback to invoke when
+     getting an array index property from your JavaScript object.
+     */
+    static void AddIndexedGetCallback(const detail::GetIndexedPropertyCallback<T>& get_indexed_property_callback);
+    
+    /*!
+     @method
+     
+     @abstract Set the callback to invoke when setting an array index
+     property (e.g. obj[0] = 1) on your JavaScript object.
+     
+     @discussion If this callback returns false then the request
+     forwards to your SetPropertyCallback (if any), then your
+     JavaScript object's prototype chain.
+     
+     For example, given this class definition:
+     
+     class Foo {
+     bool SetElement(unsigned index, const JSValue& value);
+     };
+     
+     You would call AddIndexedSetCallback like this:
+     
+     AddIndexedSetCallback(&Foo::SetElement);
+     
+     @param set_indexed_property_callback The callback to invoke when
+     setting an array index property on your JavaScript object.
+     */
+    static void AddIndexedSetCallback(const detail::SetIndexedPropertyCallback<T>& set_indexed_property_callback);
+    
+    /*!
+     @method
+     
+     @abstract Set the callback to invoke when getting the 'length'
+     property of your JavaScript object.
+     
+     @discussion The array indexes below the length are also reported
+     to the 'in' operator and enumerated by for...in loops.
+     
+     For example, given this class definition:
+     
+     class Foo {
+     unsigned GetLength() const;
+     };
+     
+     You would call AddLengthCallback like this:
+     
+     AddLengthCallback(&Foo::GetLength);
+     
+     @param get_length_callback The callback to invoke when getting
+     the 'length' property of your JavaScript object.
+     */
+    static void AddLengthCallback(const detail::GetLengthCallback<T>& get_length_callback);
+    
   private:
     
     static detail::JSExportClassDefinitionBuilder<T> builder__;
@@ -565,11 +761,26 @@ namespace HAL {
     builder__.ConvertToType(convert_to_type_callback);
   }
   
+  template<typename T>
+  void JSExport<T>::AddIndexedGetCallback(const detail::GetIndexedPropertyCallback<T>& get_indexed_property_callback) {
+    builder__.GetIndexedProperty(get_indexed_property_callback);
+  }
+  
+  template<typename T>
+  void JSExport<T>::AddIndexedSetCallback(const detail::SetIndexedPropertyCallback<T>& set_indexed_property_callback) {
+    builder__.SetIndexedProperty(set_indexed_property_callback);
+  }
+  
+  template<typename T>
+  void JSExport<T>::AddLengthCallback(const detail::GetLengthCallback<T>& get_length_callback) {
+    builder__.GetLength(get_length_callback);
+  }
+  
   template<typename T>
   detail::JSExportClassDefinitionBuilder<T> JSExport<T>::builder__ = detail::JSExportClassDefinitionBuilder<T>(typeid(T).name());
   
   template<typename T>
-  detail::JSExportClass<T> JSExport<T>::Class() {
+  const detail::JSExportClass<T>& JSExport<T>::Class() {
     static detail::JSExportClassDefinition<T> js_export_class_definition;
     static detail::JSExportClass<T>           js_export_class;
     static std::once_flag                     of;
@@ -0,0 +1,133 @@
+/**
+ * HAL
+ *
+ * Copyright (c) 2014 by Appcelerator, Inc. All Rights Reserved.
+ * Licensed under the terms of the Apache Public License.
+ * Please see the LICENSE included with this distribution for details.
+ */
+
+#ifndef _HAL_JSEXPORTALLOCATOR_HPP_
+#define _HAL_JSEXPORTALLOCATOR_HPP_
+
+#include "HAL/detail/JSBase.hpp"
+#include "HAL/detail/JSExportSlabPool.hpp"
+#include "HAL/JSContext.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <new>
+#include <type_traits>
+
+namespace HAL {
+
+  /*!
+   @class
+
+   @discussion JSExportAllocator<T> creates and destroys the native
+   object of type T behind each JavaScript object of a JSExport
+   class. The JavaScriptCore initialize callback calls Create and the
+   finalize callback calls Destroy.
+
+   By default a native object is allocated with new and freed with
+   delete. To choose a different allocation policy for your class,
+   specialize JSExportAllocator in namespace HAL before your class is
+   first used, e.g. to allocate from a pool:
+
+   namespace HAL {
+   template<>
+   struct JSExportAllocator<Foo> : JSExportPoolAllocator<Foo> {
+   };
+   }
+
+   A specialization must provide the static member functions
+   T* Create(const JSContext&) and void Destroy(T*) HAL_NOEXCEPT.
+
+   JavaScriptCore initializes an object of a derived JSExport class
+   once for each class in its parent chain, and the native object
+   created for a parent class is replaced by the one created for the
+   derived class. Because the type of the replaced object is not known
+   at that point, it is destroyed through the virtual destructor of
+   JSExportObject and its storage is freed with ::operator delete, or
+   returned to its pool. A class that is the parent of another JSExport
+   class must therefore derive from JSExportObject as its first base
+   class, and use either the default allocator or
+   JSExportPoolAllocator.
+   */
+  template<typename T>
+  struct JSExportAllocator {
+
+    static T* Create(const JSContext& js_context) {
+      return new T(js_context);
+    }
+
+    static void Destroy(T* native_object_ptr) HAL_NOEXCEPT {
+      delete native_object_ptr;
+    }
+  };
+
+  /*!
+   @class
+
+   @discussion A JSExportAllocator policy that allocates the native
+   objects of T from a slab pool that is shared by all of the
+   JavaScript objects of T. Use it for classes whose JavaScript
+   objects are created and garbage collected at a high rate, where
+   new and delete dominate the cost of an object and fragment the
+   heap.
+
+   Each slab holds SlotsPerSlab objects. A slab is allocated the first
+   time the pool runs out of free slots, and slabs are never returned
+   to the system, so the memory held by the pool is the peak number
+   of live objects rounded up to whole slabs. Use GetStatistics to
+   observe the occupancy of the pool.
+
+   The pool itself is never destroyed, because JavaScriptCore may
+   finalize objects of T during static destruction.
+   */
+  template<typename T, std::size_t SlotsPerSlab = 256>
+  struct JSExportPoolAllocator {
+
+    static_assert(SlotsPerSlab > 0, "A slab must hold at least one object");
+    static_assert(std::alignment_of<T>::value <= std::alignment_of<std::max_align_t>::value, "JSExportPoolAllocator does not support over-aligned types");
+
+    static T* Create(const JSContext& js_context) {
+      auto& pool = GetPool();
+      void* slot = pool.Allocate();
+      try {
+        return new (slot) T(js_context);
+      } catch (...) {
+        pool.Deallocate(slot);
+        throw;
+      }
+    }
+
+    static void Destroy(T* native_object_ptr) HAL_NOEXCEPT {
+      if (native_object_ptr) {
+        native_object_ptr -> ~T();
+        GetPool().Deallocate(native_object_ptr);
+      }
+    }
+
+    /*!
+     @method
+
+     @abstract Return the occupancy of the pool for T.
+     */
+    static JSExportPoolStatistics GetStatistics() {
+      return GetPool().get_statistics();
+    }
+
+  private:
+
+    static detail::JSExportSlabPool& GetPool() {
+      // A null pointer is initialized before any code runs, unlike a
+      // pointer to a new pool, whose initialization MSVC 2013 doesn't
+      // make thread-safe.
+      static std::atomic<detail::JSExportSlabPool*> pool_ptr;
+      return detail::JSExportSlabPool::GetOrCreate(pool_ptr, sizeof(T), std::alignment_of<T>::value, SlotsPerSlab);
+    }
+  };
+
+} // namespace HAL {
+
+#endif // _HAL_JSEXPORTALLOCATOR_HPP_
@@ -10,6 +10,7 @@
 #define _HAL_JSEXPORTOBJECT_HPP_
 
 #include "HAL/JSExport.hpp"
+#include "HAL/JSArguments.hpp"
 #include "HAL/JSContext.hpp"
 #include "HAL/JSString.hpp"
 #include "HAL/JSValue.hpp"
@@ -92,6 +93,27 @@ namespace HAL {
      JavaScript 'new' expression.
     */
     virtual void postCallAsConstructor(const JSContext& js_context, const std::vector<JSValue>& arguments);
+    
+    /*!
+     @method
+     
+     @abstract constructor callback which is invoked when your
+     JavaScript object is created as the result of being called in a
+     JavaScript 'new' expression, with a view of the arguments.
+     
+     @discussion This is the overload that JavaScriptCore calls. Its
+     default implementation copies the arguments into a
+     std::vector<JSValue> and calls the overload above, so override
+     this one instead to avoid the copy. The JSArguments is only valid
+     until this callback returns.
+     
+     @param js_context The JSContext in which your JavaScript object
+     is created.
+     
+     @param arguments The arguments of the JavaScript 'new'
+     expression.
+     */
+    virtual void postCallAsConstructor(const JSContext& js_context, const JSArguments& arguments);
 		
   private:
     
@@ -0,0 +1,38 @@
+/**
+ * HAL
+ *
+ * Copyright (c) 2014 by Appcelerator, Inc. All Rights Reserved.
+ * Licensed under the terms of the Apache Public License.
+ * Please see the LICENSE included with this distribution for details.
+ */
+
+#ifndef _HAL_JSITERABLE_HPP_
+#define _HAL_JSITERABLE_HPP_
+
+#include "HAL/detail/JSBase.hpp"
+#include "HAL/JSContext.hpp"
+#include "HAL/JSObject.hpp"
+#include "HAL/JSArray.hpp"
+
+#include <cstddef>
+
+namespace HAL {
+
+  template<typename Iterator>
+  JSObject JSContext::CreateIterable(Iterator first, Iterator last, std::size_t chunk_size) const {
+    // The lambda owns copies of the iterators and advances first past
+    // each chunk it converts.
+    return CreateIterable([first, last](const JSContext& js_context, std::size_t max_count) mutable {
+        Iterator chunk_last = first;
+        for (std::size_t i = 0; i < max_count && chunk_last != last; ++i) {
+          ++chunk_last;
+        }
+        const auto js_array = js_context.CreateArray(first, chunk_last);
+        first = chunk_last;
+        return js_array;
+      }, chunk_size);
+  }
+
+} // namespace HAL {
+
+#endif // _HAL_JSITERABLE_HPP_
@@ -0,0 +1,171 @@
+/**
+ * HAL
+ *
+ * Copyright (c) 2014 by Appcelerator, Inc. All Rights Reserved.
+ * Licensed under the terms of the Apache Public License.
+ * Please see the LICENSE included with this distribution for details.
+ */
+
+#ifndef _HAL_JSONSINK_HPP_
+#define _HAL_JSONSINK_HPP_
+
+#include "HAL/detail/JSBase.hpp"
+
+#include <cstddef>
+#include <string>
+#include <ostream>
+
+namespace HAL {
+
+  /*!
+   @class
+
+   @discussion A JSONSink is the destination of JSValue::WriteJSON.
+   The serialized JSON is handed to the sink as a sequence of UTF-8
+   encoded chunks of bounded size, so a large object graph can be
+   written to a buffer, stream or file descriptor without first
+   materializing it as a JSString or std::string.
+
+   Derive from JSONSink and override Write to send JSON to any other
+   destination.
+   */
+  class HAL_EXPORT JSONSink {
+
+  public:
+
+    /*!
+     @method
+
+     @abstract Consume the next chunk of UTF-8 encoded JSON.
+
+     @param data A pointer to the first byte of the chunk. The bytes
+     are only valid for the duration of the call.
+
+     @param length The number of bytes in the chunk.
+     */
+    virtual void Write(const char* data, std::size_t length) = 0;
+
+    /*!
+     @method
+
+     @abstract Called once after the last chunk of a JSON document has
+     been written. The default implementation does nothing.
+     */
+    virtual void Flush() {
+    }
+
+    /*!
+     @method
+
+     @abstract Transcode UTF-16 characters to UTF-8 and pass them to
+     Write in chunks of at most kChunkSize bytes. Unpaired surrogates
+     are replaced with U+FFFD.
+
+     @param characters A pointer to the first UTF-16 code unit.
+
+     @param length The number of UTF-16 code units.
+     */
+    void WriteUTF16(const JSChar* characters, std::size_t length);
+
+    /*!
+     @constant kChunkSize The maximum number of bytes passed to Write
+     in a single call by WriteUTF16.
+     */
+    static const std::size_t kChunkSize = 4096;
+
+    JSONSink()                           = default;
+    virtual ~JSONSink()                  = default;
+    JSONSink(const JSONSink&)            = default;
+    JSONSink& operator=(const JSONSink&) = default;
+
+#ifdef HAL_MOVE_CTOR_AND_ASSIGN_DEFAULT_ENABLE
+    JSONSink(JSONSink&&)                 = default;
+    JSONSink& operator=(JSONSink&&)      = default;
+#endif
+  };
+
+  /*!
+   @class
+
+   @discussion A JSONSink that appends to a caller-owned std::string.
+   */
+  class HAL_EXPORT JSONStringSink final : public JSONSink {
+
+  public:
+
+    explicit JSONStringSink(std::string& buffer) HAL_NOEXCEPT
+    : buffer__(buffer) {
+    }
+
+    virtual void Write(const char* data, std::size_t length) override final {
+      buffer__.append(data, length);
+    }
+
+  private:
+
+    // Silence 4251 on Windows since private member variables do not
+    // need to be exported from a DLL.
+#pragma warning(push)
+#pragma warning(disable: 4251)
+    std::string& buffer__;
+#pragma warning(pop)
+  };
+
+  /*!
+   @class
+
+   @discussion A JSONSink that writes to a caller-owned std::ostream.
+   */
+  class HAL_EXPORT JSONStreamSink final : public JSONSink {
+
+  public:
+
+    explicit JSONStreamSink(std::ostream& ostream) HAL_NOEXCEPT
+    : ostream__(ostream) {
+    }
+
+    virtual void Write(const char* data, std::size_t length) override final {
+      ostream__.write(data, static_cast<std::streamsize>(length));
+    }
+
+    virtual void Flush() override final {
+      ostream__.flush();
+    }
+
+  private:
+
+    // Silence 4251 on Windows since private member variables do not
+    // need to be exported from a DLL.
+#pragma warning(push)
+#pragma warning(disable: 4251)
+    std::ostream& ostream__;
+#pragma warning(pop)
+  };
+
+  /*!
+   @class
+
+   @discussion A JSONSink that writes to an open file descriptor, such
+   as a file or a socket. The descriptor is not closed by the sink.
+
+   @throws std::runtime_error from Write if the descriptor could not
+   be written to.
+   */
+  class HAL_EXPORT JSONFileDescriptorSink final : public JSONSink {
+
+  public:
+
+    explicit JSONFileDescriptorSink(int file_descriptor) HAL_NOEXCEPT
+    : file_descriptor__(file_descriptor) {
+    }
+
+    virtual void Write(const char* data, std::size_t length) override final;
+
+  private:
+
+    int file_descriptor__;
+  };
+
+} // namespace HAL {
+
+#endif // _HAL_JSONSINK_HPP_
@@ -15,24 +15,41 @@
 #include "HAL/JSPropertyNameArray.hpp"
 
 #include <memory>
+#include <functional>
 #include <vector>
 #include <unordered_set>
 #include <unordered_map>
+#include <utility>
 
 namespace HAL {
   class JSString;
+  class JSStringView;
   class JSValue;
+  class JSValueView;
   class JSClass;
   class JSPropertyNameAccumulator;
   class JSPropertyNameArray;
   class JSArray;
   class JSError;
+  class JSArrayBuffer;
+  class JSException;
+  
+  template<typename T>
+  class JSTypedArray;
+  
+  template<typename T>
+  class JSResult;
   
   class JSExportObject;
   
   namespace detail {
     template<typename T>
     class JSExportClass;
+    
+    class JSWeakMapBase;
+    class JSTypedArrayBase;
+    
+    HAL_EXPORT unsigned ToJSPropertyAttributes(JSPropertyAttributeSet attributes) HAL_NOEXCEPT;
   }
 }
 
@@ -84,6 +101,7 @@ namespace HAL {
      JavaScript exception.
      */
     virtual JSValue GetProperty(const JSString& property_name) const final;
+    virtual JSValue GetProperty(const JSStringView& property_name) const final;
     
     /*!
      @method
@@ -122,7 +140,63 @@ namespace HAL {
      @throws std::runtime_error if setting the property threw a
      JavaScript exception.
      */
-    virtual void SetProperty(const JSString& property_name, const JSValue& property_value, const std::unordered_set<JSPropertyAttribute>& attributes = {}) final;
+    virtual void SetProperty(const JSString& property_name, const JSValue& property_value, JSPropertyAttributeSet attributes = {}) final;
+    
+    /*!
+     @method
+     
+     @abstract Set many properties on this JavaScript object, all with
+     the same optional set of attributes.
+     
+     @discussion The attributes are converted once per batch, and no
+     property name is created or transcoded, so create the JSString
+     names once and reuse them for every batch. The properties are set
+     in order and the first JavaScript exception stops the batch.
+     
+     @param properties The names and values of the properties to set.
+     
+     @param attributes An optional set of property attributes to give
+     to every property.
+     
+     @throws std::runtime_error if setting a property threw a
+     JavaScript exception.
+     */
+    virtual void SetProperties(const std::vector<std::pair<JSString, JSValue>>& properties, JSPropertyAttributeSet attributes = {}) final;
+    
+    /*!
+     @method
+     
+     @abstract Set the properties in the range [first, last) on this
+     JavaScript object, all with the same optional set of attributes.
+     
+     @discussion Each element of the range is a pair whose first member
+     converts to a const JSString& and whose second member converts to
+     a const JSValue&, e.g. a std::pair<JSString, JSValue> or a
+     std::pair<std::reference_wrapper<const JSString>,
+     std::reference_wrapper<const JSValue>>. The names and values are
+     used in place, so a range of references to names and values you
+     already hold sets the properties without copying any of them.
+     
+     @throws std::runtime_error if setting a property threw a
+     JavaScript exception.
+     */
+    template<typename Iterator>
+    void SetProperties(Iterator first, Iterator last, JSPropertyAttributeSet attributes = {});
+    
+    /*!
+     @method
+     
+     @abstract Get many properties of this JavaScript object.
+     
+     @param property_names The names of the properties to get.
+     
+     @result The properties' values, in the same order as their names,
+     with JSUndefined for the properties this object doesn't have.
+     
+     @throws std::runtime_error if getting a property threw a
+     JavaScript exception.
+     */
+    virtual std::vector<JSValue> GetProperties(const std::vector<JSString>& property_names) const final;
     
     /*!
      @method
@@ -142,6 +216,23 @@ namespace HAL {
      */
     virtual void SetProperty(unsigned property_index, const JSValue& property_value) final;
     
+    /*!
+     @method
+     
+     @abstract Non-throwing variants of GetProperty and SetProperty.
+     
+     @discussion These member functions never throw and never inspect
+     the JavaScript exception, if any. Include "HAL/JSResult.hpp" to
+     use their result.
+     
+     @result A JSResult holding either the result of the corresponding
+     throwing member function or the JSException it would have thrown.
+     */
+    virtual JSResult<JSValue> TryGetProperty(const JSString& property_name) const HAL_NOEXCEPT final;
+    virtual JSResult<JSValue> TryGetProperty(unsigned property_index) const HAL_NOEXCEPT final;
+    virtual JSResult<void>    TrySetProperty(const JSString& property_name, const JSValue& property_value, JSPropertyAttributeSet attributes = {}) HAL_NOEXCEPT final;
+    virtual JSResult<void>    TrySetProperty(unsigned property_index, const JSValue& property_value) HAL_NOEXCEPT final;
+    
     /*!
      @method
      
@@ -176,6 +267,24 @@ namespace HAL {
      */
     virtual std::unordered_map<std::string, JSValue> GetProperties() const HAL_NOEXCEPT final;
 
+    /*!
+     @method
+     
+     @abstract Call callback with the name and value of each of this
+     JavaScript object's enumerable properties.
+     
+     @discussion Nothing is allocated per property: the name is a
+     view of the property name array and the value is only fetched
+     when its property is visited. Both views are only valid for the
+     duration of the callback; convert them to a JSString and a JSValue
+     to keep them. To visit only the names, iterate over
+     GetPropertyNames() instead.
+     
+     @throws std::runtime_error if getting a property threw a
+     JavaScript exception.
+     */
+    virtual void ForEachProperty(const std::function<void(const JSStringView& property_name, const JSValueView& property_value)>& callback) const final;
+
 
     /*!
      @method
@@ -207,6 +316,26 @@ namespace HAL {
      */
     virtual bool IsError() const HAL_NOEXCEPT final;
     
+    /*!
+     @method
+     
+     @abstract Determine whether this JavaScript object is an
+     ArrayBuffer.
+     
+     @result true if this JavaScript object is an ArrayBuffer.
+     */
+    virtual bool IsArrayBuffer() const HAL_NOEXCEPT final;
+    
+    /*!
+     @method
+     
+     @abstract Determine whether this JavaScript object is a typed
+     array, e.g. a Float32Array, of any element type.
+     
+     @result true if this JavaScript object is a typed array.
+     */
+    virtual bool IsTypedArray() const HAL_NOEXCEPT final;
+    
     /*!
      @method
      
@@ -237,6 +366,22 @@ namespace HAL {
     virtual JSValue operator()(const std::vector<JSValue>&  arguments, JSObject this_object) final;
     virtual JSValue operator()(const std::vector<JSString>& arguments, JSObject this_object) final;
     
+    /*!
+     @method
+     
+     @abstract Call this JavaScript object as a function without
+     throwing.
+     
+     @param arguments JSValue argument(s) to pass to the function.
+     
+     @param this_object The JavaScript object to use as 'this'.
+     
+     @result A JSResult holding either the function's return value or
+     the JSException describing why this JavaScript object can't be
+     called as a function or what the function threw.
+     */
+    virtual JSResult<JSValue> TryCallAsFunction(const std::vector<JSValue>& arguments, JSObject this_object) HAL_NOEXCEPT final;
+    
     /*!
      @method
      
@@ -306,6 +451,34 @@ namespace HAL {
      @result A JSValue with the result of conversion.
      */
     virtual operator JSValue() const final;
+    
+    /*!
+     @method
+     
+     @abstract Determine whether this JSObject refers to the very same
+     JavaScript object as another JSObject, as compared by the
+     JavaScript === operator, without calling JavaScriptCore.
+     
+     @param js_object The JavaScript object to test.
+     
+     @result true if both JSObjects refer to the same JavaScript
+     object.
+     */
+    virtual bool IsIdenticalTo(const JSObject& js_object) const HAL_NOEXCEPT final {
+      return js_object_ref__ == js_object.js_object_ref__;
+    }
+    
+    /*!
+     @method
+     
+     @abstract Return a hash of this JavaScript object's identity that
+     is consistent with IsIdenticalTo and operator==.
+     
+     @result The identity hash of this JavaScript object.
+     */
+    virtual std::size_t identity_hash_value() const HAL_NOEXCEPT final {
+      return std::hash<JSObjectRef>()(js_object_ref__);
+    }
 
     /*!
      @method
@@ -324,6 +497,32 @@ namespace HAL {
      @result A JSError with the result of conversion.
      */
     virtual operator JSError() const final;
+    
+    /*!
+     @method
+     
+     @abstract Convert this JSObject to a JSArrayBuffer.
+     
+     @result A JSArrayBuffer with the result of conversion.
+     
+     @throws std::invalid_argument if this JavaScript object is not an
+     ArrayBuffer.
+     */
+    virtual operator JSArrayBuffer() const final;
+    
+    /*!
+     @method
+     
+     @abstract Convert this JSObject to a JSTypedArray<T>. Include
+     "HAL/JSTypedArray.hpp" to use it.
+     
+     @result A JSTypedArray<T> with the result of conversion.
+     
+     @throws std::invalid_argument if this JavaScript object is not a
+     typed array with element type T.
+     */
+    template<typename T>
+    explicit operator JSTypedArray<T>() const;
   
     /*!
      @method
@@ -365,6 +564,10 @@ namespace HAL {
     
     // These classes need access to operator JSObjectRef().
     friend class JSPropertyNameArray;
+    friend class detail::JSWeakMapBase;
+    friend class detail::JSTypedArrayBase;
+    friend class JSArray; // CreateArray and Append
+    friend class JSObjectTemplate;
     
     // For interoperability with the JavaScriptCore C API.
     explicit operator JSObjectRef() const HAL_NOEXCEPT {
@@ -440,10 +643,24 @@ namespace HAL {
      */
     virtual void GetPropertyNames(const JSPropertyNameAccumulator& accumulator) const HAL_NOEXCEPT final;
     
+    // Set one property of a SetProperties batch.
+    void SetBatchedProperty(const JSString& property_name, const JSValue& property_value, unsigned js_property_attributes);
+    
     static void     RegisterJSContext(JSContextRef js_context_ref, JSObjectRef js_object_ref);
     static void     UnRegisterJSContext(JSObjectRef js_object_ref);
     static JSObject FindJSObject(JSContextRef js_context_ref, JSObjectRef js_object_ref);
     
+    // JSExportClass uses the following constructors for the objects it
+    // passes to callbacks. The JSObjectRef and its execution context
+    // are borrowed from JavaScriptCore for the duration of the
+    // callback, so the JSObjectRef is neither protected nor registered
+    // and the JSContext is borrowed as well. A copy or move of a
+    // borrowed JSObject is an ordinary JSObject that owns its
+    // JSObjectRef.
+    struct BorrowedTag {};
+    JSObject(const JSContext& js_context, JSObjectRef js_object_ref, BorrowedTag) HAL_NOEXCEPT;
+    JSObject(JSContextRef js_context_ref, JSObjectRef js_object_ref, BorrowedTag) HAL_NOEXCEPT;
+    
     // JSContext (and already friended JSExportClass) use the
     // following constructor.
     friend class JSContext;
@@ -457,6 +674,7 @@ namespace HAL {
 #pragma warning(push)
 #pragma warning(disable: 4251)
     JSObjectRef js_object_ref__;
+    bool        borrowed__ { false };
     static std::unordered_map<std::intptr_t, std::tuple<std::intptr_t, std::size_t>> js_object_ref_to_js_context_ref_map__;
     static std::unordered_map<std::intptr_t, std::intptr_t> js_private_data_to_js_object_ref_map__;
 #pragma warning(pop)
@@ -479,6 +697,31 @@ namespace HAL {
     first.swap(second);
   }
   
+  // Return true if the two JSObjects refer to the same JavaScript
+  // object, as compared by the JS === operator.
+  inline
+  bool operator==(const JSObject& lhs, const JSObject& rhs) HAL_NOEXCEPT {
+    return lhs.IsIdenticalTo(rhs);
+  }
+  
+  // Return true if the two JSObjects refer to different JavaScript
+  // objects.
+  inline
+  bool operator!=(const JSObject& lhs, const JSObject& rhs) HAL_NOEXCEPT {
+    return ! (lhs == rhs);
+  }
+  
+  template<typename Iterator>
+  void JSObject::SetProperties(Iterator first, Iterator last, JSPropertyAttributeSet attributes) {
+    HAL_JSOBJECT_LOCK_GUARD;
+    const auto js_property_attributes = detail::ToJSPropertyAttributes(attributes);
+    for (; first != last; ++first) {
+      const JSString& property_name  = first -> first;
+      const JSValue&  property_value = first -> second;
+      SetBatchedProperty(property_name, property_value, js_property_attributes);
+    }
+  }
+  
   template<typename T>
   std::shared_ptr<T> JSObject::GetPrivate() const HAL_NOEXCEPT {
     return std::shared_ptr<T>(std::make_shared<JSObject>(*this), dynamic_cast<T*>(static_cast<JSExportObject*>(GetPrivate())));
@@ -486,4 +729,21 @@ namespace HAL {
   
 } // namespace HAL {
 
+namespace std {
+  
+  using HAL::JSObject;
+  
+  // Hash JSObjects by identity, consistent with operator==.
+  template<>
+  struct hash<JSObject> {
+    using argument_type = JSObject;
+    using result_type   = std::size_t;
+    
+    result_type operator()(const argument_type& js_object) const HAL_NOEXCEPT {
+      return js_object.identity_hash_value();
+    }
+  };
+  
+}  // namespace std
+
 #endif // _HAL_JSOBJECT_HPP_
@@ -0,0 +1,305 @@
+/**
+ * HAL
+ *
+ * Copyright (c) 2014 by Appcelerator, Inc. All Rights Reserved.
+ * Licensed under the terms of the Apache Public License.
+ * Please see the LICENSE included with this distribution for details.
+ */
+
+#ifndef _HAL_JSOBJECTTEMPLATE_HPP_
+#define _HAL_JSOBJECTTEMPLATE_HPP_
+
+#include "HAL/detail/JSBase.hpp"
+#include "HAL/JSContext.hpp"
+#include "HAL/JSString.hpp"
+#include "HAL/JSValue.hpp"
+#include "HAL/JSObject.hpp"
+#include "HAL/JSArray.hpp"
+
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+namespace HAL {
+
+  template<typename T>
+  class JSObjectFieldDescriptor;
+
+  /*!
+   @class
+
+   @discussion A JSObjectTemplate creates JavaScript objects that all
+   have the same property names, in the same order, e.g. the rows of a
+   query result.
+
+   The property names are converted to JSStrings once, when the
+   template is created. Where possible the template also compiles a
+   JavaScript function that returns an object literal with those
+   property names, so that every object it creates shares one
+   structure (hidden class) in the engine, and creating an object
+   costs a single call into JavaScriptCore.
+
+   The only way to create a JSObjectTemplate is by using the
+   JSContext::CreateObjectTemplate member function. Include
+   "HAL/JSObjectTemplate.hpp" to use it.
+   */
+  class HAL_EXPORT JSObjectTemplate final HAL_PERFORMANCE_COUNTER1(JSObjectTemplate) {
+
+  public:
+
+    /*!
+     @method
+
+     @abstract Return the execution context of this template.
+     */
+    JSContext get_context() const HAL_NOEXCEPT {
+      return js_context__;
+    }
+
+    /*!
+     @method
+
+     @abstract Return the property names of the objects this template
+     creates, in order.
+     */
+    const std::vector<JSString>& get_property_names() const HAL_NOEXCEPT {
+      return property_names__;
+    }
+
+    /*!
+     @method
+
+     @abstract Return the number of properties of the objects this
+     template creates.
+     */
+    std::size_t size() const HAL_NOEXCEPT {
+      return property_names__.size();
+    }
+
+    /*!
+     @method
+
+     @abstract Create a JavaScript object whose i-th property has the
+     i-th property name of this template and the value values[i].
+
+     @param values A pointer to size() JSValues, or a vector of them.
+
+     @result A new JSObject.
+
+     @throws std::invalid_argument if the number of values is not
+     size().
+
+     @throws std::runtime_error if creating the object threw a
+     JavaScript exception.
+     */
+    JSObject Instantiate(const JSValue* values, std::size_t count) const;
+    JSObject Instantiate(const std::vector<JSValue>& values) const;
+
+    /*!
+     @method
+
+     @abstract Create a JavaScript Array holding one object per native
+     record in the range [first, last), whose property values are
+     read from each record through a JSObjectFieldDescriptor.
+
+     @discussion The descriptor's property names must be this
+     template's property names, in the same order. Create the template
+     from JSObjectFieldDescriptor::get_property_names() to guarantee
+     this.
+
+     @result A JSArray of new JSObjects.
+
+     @throws std::invalid_argument if the descriptor's property names
+     differ from this template's.
+
+     @throws std::runtime_error if creating an object threw a
+     JavaScript exception.
+     */
+    template<typename Iterator, typename T>
+    JSArray Instantiate(Iterator first, Iterator last, const JSObjectFieldDescriptor<T>& fields) const;
+
+    template<typename T>
+    JSArray Instantiate(const std::vector<T>& records, const JSObjectFieldDescriptor<T>& fields) const;
+
+  private:
+
+    // Only JSContext can create a JSObjectTemplate.
+    friend class JSContext;
+
+    template<typename T>
+    friend class JSObjectFieldDescriptor;
+
+    JSObjectTemplate(const JSContext& js_context, const std::vector<JSString>& property_names);
+
+    // Create an object from size() values. If unprotect is true then
+    // every value is unprotected afterwards, even if an exception is
+    // thrown.
+    JSObjectRef MakeObject(const JSValueRef values[], bool unprotect) const;
+
+    // Create an object from the protected values of a record, which
+    // are unprotected. The object is protected until the Array
+    // created by MakeArray holds it.
+    JSValueRef MakeProtectedObject(const std::vector<JSValueRef>& js_value_refs) const;
+
+    // Throw std::invalid_argument unless property_names are this
+    // template's property names.
+    void ThrowIfFieldsDiffer(const std::vector<JSString>& property_names) const;
+
+    // Convert a native field value for MakeObject, like
+    // JSContext::CreateArray converts a native element. The JSValueRef
+    // returned for anything other than a number or a bool is
+    // protected.
+    template<typename U>
+    static JSValueRef MakeValue(const JSContext& js_context, const U& value) {
+      return JSArray::MakeElement(js_context, static_cast<typename detail::JSArrayElementTraits<U>::argument_type>(value));
+    }
+
+    static void UnprotectValues(const JSContext& js_context, const std::vector<JSValueRef>& js_value_refs) HAL_NOEXCEPT {
+      JSArray::UnprotectElements(js_context, js_value_refs);
+    }
+
+    // Create an Array of the objects created by MakeProtectedObject,
+    // which are unprotected.
+    static JSArray MakeArray(const JSContext& js_context, const std::vector<JSValueRef>& js_object_refs);
+
+    JSContext js_context__;
+
+    // Silence 4251 on Windows since private member variables do not
+    // need to be exported from a DLL.
+#pragma warning(push)
+#pragma warning(disable: 4251)
+    std::vector<JSString> property_names__;
+
+    // The compiled object literal function, or undefined if it could
+    // not be compiled, in which case the properties are set one at a
+    // time. js_constructor_ref__ is kept alive by js_constructor__.
+    JSValue     js_constructor__;
+    JSObjectRef js_constructor_ref__ { nullptr };
+#pragma warning(pop)
+  };
+
+  /*!
+   @class
+
+   @discussion A JSObjectFieldDescriptor describes how to read the
+   property values of a JavaScript object from a native record of type
+   T, for JSObjectTemplate::Instantiate. Each field has a property
+   name and either a pointer to a data member of T or an accessor
+   function.
+
+   Data members that are arithmetic types become JavaScript numbers,
+   bool becomes a JavaScript boolean, and const char*, std::string and
+   JSString become JavaScript strings. JSValue and JSObject members
+   are used as is.
+
+   Example:
+
+   JSObjectFieldDescriptor<Point> fields;
+   fields.AddField("x", &Point::x).AddField("y", &Point::y);
+   auto js_template = js_context.CreateObjectTemplate(fields.get_property_names());
+   JSArray js_points = js_template.Instantiate(points, fields);
+   */
+  template<typename T>
+  class JSObjectFieldDescriptor final {
+
+  public:
+
+    typedef std::function<JSValue(const JSContext&, const T&)> Accessor;
+
+    /*!
+     @method
+
+     @abstract Add a field whose value is the data member field of a
+     record.
+     */
+    template<typename U>
+    JSObjectFieldDescriptor& AddField(const JSString& property_name, U T::* field) {
+      property_names__.push_back(property_name);
+      accessors__.push_back([field](const JSContext& js_context, const T& record) {
+          return JSObjectTemplate::MakeValue(js_context, record.*field);
+        });
+      return *this;
+    }
+
+    /*!
+     @method
+
+     @abstract Add a field whose value is returned by accessor for a
+     record.
+     */
+    JSObjectFieldDescriptor& AddField(const JSString& property_name, Accessor accessor) {
+      property_names__.push_back(property_name);
+      accessors__.push_back([accessor](const JSContext& js_context, const T& record) {
+          return JSObjectTemplate::MakeValue(js_context, accessor(js_context, record));
+        });
+      return *this;
+    }
+
+    /*!
+     @method
+
+     @abstract Return the property names of the fields, in the order
+     they were added.
+     */
+    const std::vector<JSString>& get_property_names() const HAL_NOEXCEPT {
+      return property_names__;
+    }
+
+    std::size_t size() const HAL_NOEXCEPT {
+      return property_names__.size();
+    }
+
+  private:
+
+    friend class JSObjectTemplate;
+
+    // Replace js_value_refs with the protected values of the fields of
+    // record. Nothing is left protected if an exception is thrown.
+    void MakeValues(const JSContext& js_context, const T& record, std::vector<JSValueRef>& js_value_refs) const {
+      js_value_refs.clear();
+      try {
+        for (const auto& accessor : accessors__) {
+          js_value_refs.push_back(accessor(js_context, record));
+        }
+      } catch (...) {
+        JSObjectTemplate::UnprotectValues(js_context, js_value_refs);
+        throw;
+      }
+    }
+
+    std::vector<JSString>                                           property_names__;
+    std::vector<std::function<JSValueRef(const JSContext&, const T&)>> accessors__;
+  };
+
+  template<typename Iterator, typename T>
+  JSArray JSObjectTemplate::Instantiate(Iterator first, Iterator last, const JSObjectFieldDescriptor<T>& fields) const {
+    ThrowIfFieldsDiffer(fields.get_property_names());
+
+    std::vector<JSValueRef> js_object_refs;
+    detail::ReserveForRange(js_object_refs, first, last, typename std::iterator_traits<Iterator>::iterator_category());
+
+    std::vector<JSValueRef> js_value_refs;
+    js_value_refs.reserve(fields.size());
+    try {
+      for (; first != last; ++first) {
+        fields.MakeValues(js_context__, *first, js_value_refs);
+        js_object_refs.push_back(MakeProtectedObject(js_value_refs));
+      }
+    } catch (...) {
+      UnprotectValues(js_context__, js_object_refs);
+      throw;
+    }
+
+    return MakeArray(js_context__, js_object_refs);
+  }
+
+  template<typename T>
+  JSArray JSObjectTemplate::Instantiate(const std::vector<T>& records, const JSObjectFieldDescriptor<T>& fields) const {
+    return Instantiate(records.begin(), records.end(), fields);
+  }
+
+} // namespace HAL {
+
+#endif // _HAL_JSOBJECTTEMPLATE_HPP_
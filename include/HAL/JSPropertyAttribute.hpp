@@ -9,8 +9,13 @@
 #ifndef _HAL_JSPROPERTYATTRIBUTE_HPP_
 #define _HAL_JSPROPERTYATTRIBUTE_HPP_
 
+#include "HAL/detail/JSBase.hpp"
+
 #include <cstddef>
+#include <cstdint>
 #include <functional>
+#include <initializer_list>
+#include <unordered_set>
 
 namespace HAL {
 
@@ -36,7 +41,6 @@ enum class HAL_EXPORT JSPropertyAttribute : std::uint32_t /* typedef unsigned JS
 
 } // namespace HAL {
 
-
 // Provide a hash function so that a JSPropertyAttribute can be
 // stored in an unordered container.
 namespace std {
@@ -57,4 +61,154 @@ struct hash<JSPropertyAttribute> {
 
 }  // namespace std {
 
+namespace HAL {
+
+/*!
+  @class
+
+  @discussion A JSPropertyAttributeSet is a set of
+  JSPropertyAttributes stored as a bit mask, using the same bit
+  values as the JavaScriptCore C API's JSPropertyAttributes. Copying
+  one or passing it to JSObject::SetProperty never allocates.
+
+  It has the subset of the std::unordered_set interface that HAL
+  uses (count, empty, insert and erase), and converts implicitly
+  from a single JSPropertyAttribute, a braced list of them and a
+  std::unordered_set<JSPropertyAttribute>, so existing callers
+  compile unchanged.
+
+  As with JavaScriptCore, JSPropertyAttribute::None is the empty set,
+  so count(JSPropertyAttribute::None) is 1 only when no other
+  attribute is set.
+*/
+class HAL_EXPORT JSPropertyAttributeSet final {
+
+public:
+
+	typedef JSPropertyAttribute value_type;
+
+	HAL_CONSTEXPR JSPropertyAttributeSet() HAL_NOEXCEPT
+	: bits__(0) {
+	}
+
+	HAL_CONSTEXPR JSPropertyAttributeSet(JSPropertyAttribute attribute) HAL_NOEXCEPT
+	: bits__(ToBit(attribute)) {
+	}
+
+	JSPropertyAttributeSet(std::initializer_list<JSPropertyAttribute> attributes) HAL_NOEXCEPT
+	: bits__(0) {
+		for (auto attribute : attributes) {
+			bits__ |= ToBit(attribute);
+		}
+	}
+
+	// For source compatibility with the std::unordered_set based API.
+	JSPropertyAttributeSet(const std::unordered_set<JSPropertyAttribute>& attributes) HAL_NOEXCEPT
+	: bits__(0) {
+		for (auto attribute : attributes) {
+			bits__ |= ToBit(attribute);
+		}
+	}
+
+	/*!
+	  @method
+
+	  @abstract Return the JavaScriptCore C API JSPropertyAttributes
+	  bit mask for this set.
+	*/
+	HAL_CONSTEXPR std::uint32_t get_bits() const HAL_NOEXCEPT {
+		return bits__;
+	}
+
+	HAL_CONSTEXPR bool empty() const HAL_NOEXCEPT {
+		return bits__ == 0;
+	}
+
+	HAL_CONSTEXPR std::size_t count(JSPropertyAttribute attribute) const HAL_NOEXCEPT {
+		return attribute == JSPropertyAttribute::None ? (bits__ == 0 ? 1 : 0) : ((bits__ & ToBit(attribute)) ? 1 : 0);
+	}
+
+	// Return true if attribute was not already in this set.
+	bool insert(JSPropertyAttribute attribute) HAL_NOEXCEPT {
+		const bool inserted = count(attribute) == 0;
+		bits__ |= ToBit(attribute);
+		return inserted;
+	}
+
+	// Return the number of attributes removed, which is 0 or 1.
+	std::size_t erase(JSPropertyAttribute attribute) HAL_NOEXCEPT {
+		const std::size_t erased = attribute == JSPropertyAttribute::None ? 0 : count(attribute);
+		bits__ &= ~ToBit(attribute);
+		return erased;
+	}
+
+	void clear() HAL_NOEXCEPT {
+		bits__ = 0;
+	}
+
+	JSPropertyAttributeSet& operator|=(JSPropertyAttributeSet rhs) HAL_NOEXCEPT {
+		bits__ |= rhs.bits__;
+		return *this;
+	}
+
+	JSPropertyAttributeSet& operator&=(JSPropertyAttributeSet rhs) HAL_NOEXCEPT {
+		bits__ &= rhs.bits__;
+		return *this;
+	}
+
+	/*!
+	  @method
+
+	  @abstract Create a JSPropertyAttributeSet from a JavaScriptCore C
+	  API JSPropertyAttributes bit mask. Unknown bits are ignored.
+	*/
+	static HAL_CONSTEXPR JSPropertyAttributeSet FromBits(std::uint32_t bits) HAL_NOEXCEPT {
+		return JSPropertyAttributeSet(bits & (ToBit(JSPropertyAttribute::ReadOnly) | ToBit(JSPropertyAttribute::DontEnum) | ToBit(JSPropertyAttribute::DontDelete)), 0);
+	}
+
+private:
+
+	// The second parameter only distinguishes this constructor from
+	// the one taking a JSPropertyAttribute.
+	HAL_CONSTEXPR JSPropertyAttributeSet(std::uint32_t bits, int) HAL_NOEXCEPT
+	: bits__(bits) {
+	}
+
+	// kJSPropertyAttributeReadOnly is 1 << 1, kJSPropertyAttributeDontEnum
+	// is 1 << 2 and kJSPropertyAttributeDontDelete is 1 << 3, which
+	// matches the enumerator values.
+	static HAL_CONSTEXPR std::uint32_t ToBit(JSPropertyAttribute attribute) HAL_NOEXCEPT {
+		return attribute == JSPropertyAttribute::None ? 0 : (1u << static_cast<std::uint32_t>(attribute));
+	}
+
+	std::uint32_t bits__;
+};
+
+inline HAL_CONSTEXPR
+JSPropertyAttributeSet operator|(JSPropertyAttributeSet lhs, JSPropertyAttributeSet rhs) HAL_NOEXCEPT {
+	return JSPropertyAttributeSet::FromBits(lhs.get_bits() | rhs.get_bits());
+}
+
+inline HAL_CONSTEXPR
+JSPropertyAttributeSet operator|(JSPropertyAttribute lhs, JSPropertyAttribute rhs) HAL_NOEXCEPT {
+	return JSPropertyAttributeSet(lhs) | JSPropertyAttributeSet(rhs);
+}
+
+inline HAL_CONSTEXPR
+JSPropertyAttributeSet operator&(JSPropertyAttributeSet lhs, JSPropertyAttributeSet rhs) HAL_NOEXCEPT {
+	return JSPropertyAttributeSet::FromBits(lhs.get_bits() & rhs.get_bits());
+}
+
+inline HAL_CONSTEXPR
+bool operator==(JSPropertyAttributeSet lhs, JSPropertyAttributeSet rhs) HAL_NOEXCEPT {
+	return lhs.get_bits() == rhs.get_bits();
+}
+
+inline HAL_CONSTEXPR
+bool operator!=(JSPropertyAttributeSet lhs, JSPropertyAttributeSet rhs) HAL_NOEXCEPT {
+	return ! (lhs == rhs);
+}
+
+} // namespace HAL {
+
 #endif // _HAL_JSPROPERTYATTRIBUTE_HPP_
@@ -10,7 +10,10 @@
 #define _HAL_DETAIL_JSPROPERTYNAMEARRAY_HPP_
 
 #include "HAL/detail/JSBase.hpp"
+#include "HAL/JSStringView.hpp"
 
+#include <cstddef>
+#include <iterator>
 #include <vector>
 
 namespace HAL {
@@ -63,6 +66,67 @@ namespace HAL {
      */
     operator std::vector<JSString>() const HAL_NOEXCEPT;
     
+    /*!
+     @class
+     
+     @discussion A forward iterator over the names in a
+     JSPropertyNameArray that yields JSStringViews, so iterating
+     neither retains nor transcodes each name. The iterator is
+     invalidated when the JSPropertyNameArray is destroyed.
+     */
+    class HAL_EXPORT const_iterator final {
+      
+    public:
+      
+      typedef std::forward_iterator_tag iterator_category;
+      typedef JSStringView              value_type;
+      typedef std::ptrdiff_t            difference_type;
+      typedef const JSStringView*       pointer;
+      typedef JSStringView              reference;
+      
+      JSStringView operator*() const HAL_NOEXCEPT;
+      
+      const_iterator& operator++() HAL_NOEXCEPT {
+        ++index__;
+        return *this;
+      }
+      
+      const_iterator operator++(int) HAL_NOEXCEPT {
+        const_iterator previous(*this);
+        ++index__;
+        return previous;
+      }
+      
+      bool operator==(const const_iterator& rhs) const HAL_NOEXCEPT {
+        return index__ == rhs.index__;
+      }
+      
+      bool operator!=(const const_iterator& rhs) const HAL_NOEXCEPT {
+        return index__ != rhs.index__;
+      }
+      
+    private:
+      
+      friend class JSPropertyNameArray;
+      
+      const_iterator(JSPropertyNameArrayRef js_property_name_array_ref, std::size_t index) HAL_NOEXCEPT
+      : js_property_name_array_ref__(js_property_name_array_ref)
+      , index__(index) {
+      }
+      
+      JSPropertyNameArrayRef js_property_name_array_ref__ { nullptr };
+      std::size_t            index__                      { 0 };
+    };
+    
+    /*!
+     @method
+     
+     @abstract Return iterators over the names in this JavaScript
+     property name array.
+     */
+    const_iterator begin() const HAL_NOEXCEPT;
+    const_iterator end() const HAL_NOEXCEPT;
+    
     JSPropertyNameArray()                               = delete;;
     ~JSPropertyNameArray()                              HAL_NOEXCEPT;
     JSPropertyNameArray(const JSPropertyNameArray&)     HAL_NOEXCEPT;
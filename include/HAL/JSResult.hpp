@@ -0,0 +1,301 @@
+/**
+ * HAL
+ *
+ * Copyright (c) 2014 by Appcelerator, Inc. All Rights Reserved.
+ * Licensed under the terms of the Apache Public License.
+ * Please see the LICENSE included with this distribution for details.
+ */
+
+#ifndef _HAL_JSRESULT_HPP_
+#define _HAL_JSRESULT_HPP_
+
+#include "HAL/detail/JSBase.hpp"
+#include "HAL/JSException.hpp"
+
+#include <cassert>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace HAL {
+
+  /*!
+   @class
+
+   @discussion A JSResult is the return value of the non-throwing
+   Try* member functions, e.g. JSObject::TryGetProperty. It holds
+   either the value of type T that the corresponding throwing member
+   function would have returned, or the JSException describing why the
+   operation failed.
+
+   The Try* member functions never throw and never inspect the thrown
+   JavaScript value, which makes them suitable for failure-heavy code
+   such as input validation. Calling value() on a failed JSResult
+   throws the same exception as the throwing member function.
+
+   Example:
+
+   auto result = js_object.TryGetProperty("foo");
+   if (result) {
+     use(*result);
+   } else {
+     log(result.error().message());
+   }
+   */
+  template<typename T>
+  class JSResult final {
+
+  public:
+
+    JSResult(T value) HAL_NOEXCEPT
+    : has_value__(true) {
+      ::new (static_cast<void*>(&storage__)) T(std::move(value));
+    }
+
+    JSResult(JSException js_exception) HAL_NOEXCEPT
+    : has_value__(false) {
+      ::new (static_cast<void*>(&storage__)) JSException(std::move(js_exception));
+    }
+
+    /*!
+     @method
+
+     @abstract Determine whether the operation succeeded.
+     */
+    bool has_value() const HAL_NOEXCEPT {
+      return has_value__;
+    }
+
+    explicit operator bool() const HAL_NOEXCEPT {
+      return has_value__;
+    }
+
+    /*!
+     @method
+
+     @abstract Return the result of the operation.
+
+     @throws std::runtime_error or one of its subclasses if the
+     operation failed, see JSException::Throw.
+     */
+    T& value() {
+      if (!has_value__) {
+        error().Throw();
+      }
+      return *get_value_ptr();
+    }
+
+    const T& value() const {
+      if (!has_value__) {
+        error().Throw();
+      }
+      return *get_value_ptr();
+    }
+
+    /*!
+     @method
+
+     @abstract Return the result of the operation if it succeeded,
+     otherwise default_value.
+     */
+    T value_or(T default_value) const {
+      return has_value__ ? *get_value_ptr() : std::move(default_value);
+    }
+
+    // Precondition: has_value() is true.
+    T& operator*() HAL_NOEXCEPT {
+      assert(has_value__);
+      return *get_value_ptr();
+    }
+
+    const T& operator*() const HAL_NOEXCEPT {
+      assert(has_value__);
+      return *get_value_ptr();
+    }
+
+    T* operator->() HAL_NOEXCEPT {
+      assert(has_value__);
+      return get_value_ptr();
+    }
+
+    const T* operator->() const HAL_NOEXCEPT {
+      assert(has_value__);
+      return get_value_ptr();
+    }
+
+    /*!
+     @method
+
+     @abstract Return the reason the operation failed.
+
+     @discussion Precondition: has_value() is false.
+     */
+    const JSException& error() const HAL_NOEXCEPT {
+      assert(!has_value__);
+      return *get_exception_ptr();
+    }
+
+    ~JSResult() HAL_NOEXCEPT {
+      destroy();
+    }
+
+    JSResult(const JSResult& rhs)
+    : has_value__(rhs.has_value__) {
+      if (has_value__) {
+        ::new (static_cast<void*>(&storage__)) T(*rhs.get_value_ptr());
+      } else {
+        ::new (static_cast<void*>(&storage__)) JSException(*rhs.get_exception_ptr());
+      }
+    }
+
+    JSResult(JSResult&& rhs) HAL_NOEXCEPT
+    : has_value__(rhs.has_value__) {
+      if (has_value__) {
+        ::new (static_cast<void*>(&storage__)) T(std::move(*rhs.get_value_ptr()));
+      } else {
+        ::new (static_cast<void*>(&storage__)) JSException(std::move(*rhs.get_exception_ptr()));
+      }
+    }
+
+    JSResult& operator=(JSResult rhs) {
+      destroy();
+      has_value__ = rhs.has_value__;
+      if (has_value__) {
+        ::new (static_cast<void*>(&storage__)) T(std::move(*rhs.get_value_ptr()));
+      } else {
+        ::new (static_cast<void*>(&storage__)) JSException(std::move(*rhs.get_exception_ptr()));
+      }
+      return *this;
+    }
+
+  private:
+
+    T* get_value_ptr() HAL_NOEXCEPT {
+      return reinterpret_cast<T*>(&storage__);
+    }
+
+    const T* get_value_ptr() const HAL_NOEXCEPT {
+      return reinterpret_cast<const T*>(&storage__);
+    }
+
+    JSException* get_exception_ptr() HAL_NOEXCEPT {
+      return reinterpret_cast<JSException*>(&storage__);
+    }
+
+    const JSException* get_exception_ptr() const HAL_NOEXCEPT {
+      return reinterpret_cast<const JSException*>(&storage__);
+    }
+
+    void destroy() HAL_NOEXCEPT {
+      if (has_value__) {
+        get_value_ptr() -> ~T();
+      } else {
+        get_exception_ptr() -> ~JSException();
+      }
+    }
+
+    static const std::size_t storage_size__      = sizeof(T) > sizeof(JSException) ? sizeof(T) : sizeof(JSException);
+    static const std::size_t storage_alignment__ = std::alignment_of<T>::value > std::alignment_of<JSException>::value ? std::alignment_of<T>::value : std::alignment_of<JSException>::value;
+
+    bool has_value__;
+    typename std::aligned_storage<storage_size__, storage_alignment__>::type storage__;
+  };
+
+  /*!
+   @class
+
+   @discussion The JSResult of a Try* member function that returns
+   nothing on success, e.g. JSObject::TrySetProperty.
+   */
+  template<>
+  class JSResult<void> final {
+
+  public:
+
+    JSResult() HAL_NOEXCEPT
+    : has_value__(true) {
+    }
+
+    JSResult(JSException js_exception) HAL_NOEXCEPT
+    : has_value__(false) {
+      ::new (static_cast<void*>(&storage__)) JSException(std::move(js_exception));
+    }
+
+    bool has_value() const HAL_NOEXCEPT {
+      return has_value__;
+    }
+
+    explicit operator bool() const HAL_NOEXCEPT {
+      return has_value__;
+    }
+
+    /*!
+     @method
+
+     @abstract Throw if the operation failed.
+
+     @throws std::runtime_error or one of its subclasses if the
+     operation failed, see JSException::Throw.
+     */
+    void value() const {
+      if (!has_value__) {
+        error().Throw();
+      }
+    }
+
+    // Precondition: has_value() is false.
+    const JSException& error() const HAL_NOEXCEPT {
+      assert(!has_value__);
+      return *get_exception_ptr();
+    }
+
+    ~JSResult() HAL_NOEXCEPT {
+      destroy();
+    }
+
+    JSResult(const JSResult& rhs)
+    : has_value__(rhs.has_value__) {
+      if (!has_value__) {
+        ::new (static_cast<void*>(&storage__)) JSException(*rhs.get_exception_ptr());
+      }
+    }
+
+    JSResult(JSResult&& rhs) HAL_NOEXCEPT
+    : has_value__(rhs.has_value__) {
+      if (!has_value__) {
+        ::new (static_cast<void*>(&storage__)) JSException(std::move(*rhs.get_exception_ptr()));
+      }
+    }
+
+    JSResult& operator=(JSResult rhs) {
+      destroy();
+      has_value__ = rhs.has_value__;
+      if (!has_value__) {
+        ::new (static_cast<void*>(&storage__)) JSException(std::move(*rhs.get_exception_ptr()));
+      }
+      return *this;
+    }
+
+  private:
+
+    JSException* get_exception_ptr() HAL_NOEXCEPT {
+      return reinterpret_cast<JSException*>(&storage__);
+    }
+
+    const JSException* get_exception_ptr() const HAL_NOEXCEPT {
+      return reinterpret_cast<const JSException*>(&storage__);
+    }
+
+    void destroy() HAL_NOEXCEPT {
+      if (!has_value__) {
+        get_exception_ptr() -> ~JSException();
+      }
+    }
+
+    bool has_value__;
+    std::aligned_storage<sizeof(JSException), std::alignment_of<JSException>::value>::type storage__;
+  };
+
+} // namespace HAL {
+
+#endif // _HAL_JSRESULT_HPP_
@@ -0,0 +1,126 @@
+/**
+ * HAL
+ *
+ * Copyright (c) 2014 by Appcelerator, Inc. All Rights Reserved.
+ * Licensed under the terms of the Apache Public License.
+ * Please see the LICENSE included with this distribution for details.
+ */
+
+#ifndef _HAL_JSSHAREDBUFFER_HPP_
+#define _HAL_JSSHAREDBUFFER_HPP_
+
+#include "HAL/detail/JSBase.hpp"
+#include "HAL/JSContext.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace HAL {
+
+  /*!
+   @class
+
+   @discussion A JSSharedBuffer is a reference counted block of native
+   memory that can be surfaced as an ArrayBuffer in any number of
+   JSContexts, in any number of JSContextGroups, at the same time and
+   without copying, using JSContext::CreateArrayBuffer.
+
+   Every such ArrayBuffer, and every copy of the JSSharedBuffer, holds
+   a reference to the memory. The memory is released when the last
+   JSSharedBuffer is destroyed and the last ArrayBuffer over it has
+   been garbage collected.
+
+   JSSharedBuffers are meant for read-only reference data such as
+   lookup tables. JavaScriptCore has no read-only ArrayBuffers, so a
+   script that writes to one changes the data seen by every holder,
+   with no synchronization between context groups.
+   */
+  class HAL_EXPORT JSSharedBuffer final HAL_PERFORMANCE_COUNTER1(JSSharedBuffer) {
+
+  public:
+
+    /*!
+     @method
+
+     @abstract Create a JSSharedBuffer that takes over the storage of
+     a vector of bytes without copying it.
+     */
+    explicit JSSharedBuffer(std::vector<std::uint8_t> bytes);
+
+    /*!
+     @method
+
+     @abstract Create a JSSharedBuffer over native memory owned by the
+     caller, e.g. a memory mapped file. deallocator is called with
+     bytes once the last holder has released it.
+     */
+    JSSharedBuffer(const void* bytes, std::size_t byte_length, JSBytesDeallocator deallocator);
+
+    /*!
+     @method
+
+     @abstract Return a pointer to the first byte of this buffer, or
+     nullptr if it is empty.
+     */
+    const std::uint8_t* data() const HAL_NOEXCEPT {
+      return bytes__.get();
+    }
+
+    /*!
+     @method
+
+     @abstract Return the number of bytes in this buffer.
+     */
+    std::size_t size() const HAL_NOEXCEPT {
+      return byte_length__;
+    }
+
+    bool empty() const HAL_NOEXCEPT {
+      return byte_length__ == 0;
+    }
+
+    const std::uint8_t* begin() const HAL_NOEXCEPT {
+      return data();
+    }
+
+    const std::uint8_t* end() const HAL_NOEXCEPT {
+      return data() + size();
+    }
+
+    /*!
+     @method
+
+     @abstract Return the number of JSSharedBuffers and ArrayBuffers
+     currently holding this buffer's memory.
+     */
+    long use_count() const HAL_NOEXCEPT {
+      return bytes__.use_count();
+    }
+
+    ~JSSharedBuffer()                                = default;
+    JSSharedBuffer(const JSSharedBuffer&)            = default;
+    JSSharedBuffer& operator=(const JSSharedBuffer&) = default;
+
+#ifdef HAL_MOVE_CTOR_AND_ASSIGN_DEFAULT_ENABLE
+    JSSharedBuffer(JSSharedBuffer&&)                 = default;
+    JSSharedBuffer& operator=(JSSharedBuffer&&)      = default;
+#endif
+
+  private:
+
+    friend class JSContext;
+
+    // Silence 4251 on Windows since private member variables do not
+    // need to be exported from a DLL.
+#pragma warning(push)
+#pragma warning(disable: 4251)
+    std::shared_ptr<const std::uint8_t> bytes__;
+    std::size_t                         byte_length__;
+#pragma warning(pop)
+  };
+
+} // namespace HAL {
+
+#endif // _HAL_JSSHAREDBUFFER_HPP_
@@ -21,12 +21,15 @@
 
 namespace HAL {
   class JSString;
+  class JSStringView;
 }
 
 namespace HAL { namespace detail {
   template<typename T>
   class JSExportClass;
   
+  class JSWeakMapBase;
+  
   HAL_EXPORT std::vector<JSStringRef> to_vector(const std::vector<JSString>&);
 }}
 
@@ -156,8 +159,12 @@ namespace HAL {
       friend class JSPropertyNameArray;       // GetNameAtIndex
       friend class JSPropertyNameAccumulator; // AddName
       friend class JSFunction;
+      friend class JSArray;                   // CreateArray
+      friend class JSObjectTemplate;          // property names
+      friend class detail::JSWeakMapBase;       // sentinel property name
       
       friend std::vector<JSStringRef> detail::to_vector(const std::vector<JSString>&);
+      HAL_EXPORT friend bool operator==(const JSStringView& lhs, const JSString& rhs) HAL_NOEXCEPT;
       
       // For interoperability with the JavaScriptCore C API.
       explicit operator JSStringRef() const {
@@ -166,6 +173,8 @@ namespace HAL {
       
       // Only the following classes and functions can create a JSString.
       friend class JSValue;
+      friend class JSValueView;
+      friend class JSStringView;
       
       template<typename T>
       friend class detail::JSExportClass; // static functions
@@ -0,0 +1,131 @@
+/**
+ * HAL
+ *
+ * Copyright (c) 2014 by Appcelerator, Inc. All Rights Reserved.
+ * Licensed under the terms of the Apache Public License.
+ * Please see the LICENSE included with this distribution for details.
+ */
+
+#ifndef _HAL_JSSTRINGVIEW_HPP_
+#define _HAL_JSSTRINGVIEW_HPP_
+
+#include "HAL/detail/JSBase.hpp"
+
+#include <cstddef>
+#include <string>
+
+namespace HAL {
+  
+  class JSString;
+  class JSObject;
+  class JSPropertyNameArray;
+  class JSPropertyNameAccumulator;
+  
+  /*!
+   @class
+   
+   @discussion A JSStringView is a non-owning handle to a JavaScript
+   string that is kept alive by something else, e.g. a name in a
+   JSPropertyNameArray being iterated.
+   
+   Unlike a JSString, creating and copying a JSStringView neither
+   retains the string nor transcodes it to UTF-8. The characters are
+   only converted when the JSStringView is converted to a std::string
+   or a JSString. It is only valid while its owner is alive.
+   */
+  class HAL_EXPORT JSStringView final {
+    
+  public:
+    
+    /*!
+     @method
+     
+     @abstract Return the number of UTF-16 code units in this
+     JavaScript string.
+     */
+    std::size_t length() const HAL_NOEXCEPT;
+    
+    std::size_t size() const HAL_NOEXCEPT {
+      return length();
+    }
+    
+    bool empty() const HAL_NOEXCEPT {
+      return length() == 0;
+    }
+    
+    /*!
+     @method
+     
+     @abstract Return a pointer to the UTF-16 code units of this
+     JavaScript string, which are not null terminated.
+     */
+    const JSChar* data() const HAL_NOEXCEPT;
+    
+    /*!
+     @method
+     
+     @abstract Convert this JavaScript string to a UTF-8 std::string.
+     */
+    explicit operator std::string() const HAL_NOEXCEPT;
+    
+    /*!
+     @method
+     
+     @abstract Return an owning JSString for this JavaScript string.
+     */
+    operator JSString() const HAL_NOEXCEPT;
+    
+  private:
+    
+    // Only the following classes can create a JSStringView.
+    friend class JSObject;
+    friend class JSPropertyNameArray;
+    
+    explicit JSStringView(JSStringRef js_string_ref) HAL_NOEXCEPT
+    : js_string_ref__(js_string_ref) {
+    }
+    
+    // These classes and functions need access to operator
+    // JSStringRef().
+    friend class JSPropertyNameAccumulator;
+    HAL_EXPORT friend bool operator==(const JSStringView& lhs, const char* rhs) HAL_NOEXCEPT;
+    HAL_EXPORT friend bool operator==(const JSStringView& lhs, const JSString& rhs) HAL_NOEXCEPT;
+    
+    // For interoperability with the JavaScriptCore C API.
+    explicit operator JSStringRef() const HAL_NOEXCEPT {
+      return js_string_ref__;
+    }
+    
+    // Silence 4251 on Windows since private member variables do not
+    // need to be exported from a DLL.
+#pragma warning(push)
+#pragma warning(disable: 4251)
+    JSStringRef js_string_ref__ { nullptr };
+#pragma warning(pop)
+  };
+  
+  // Return true if the JavaScript string is equal to the UTF-8
+  // string, without transcoding either of them.
+  HAL_EXPORT bool operator==(const JSStringView& lhs, const char* rhs) HAL_NOEXCEPT;
+  
+  // Return true if the two JavaScript strings are equal.
+  HAL_EXPORT bool operator==(const JSStringView& lhs, const JSString& rhs) HAL_NOEXCEPT;
+  
+  inline
+  bool operator!=(const JSStringView& lhs, const char* rhs) HAL_NOEXCEPT {
+    return !(lhs == rhs);
+  }
+  
+  inline
+  bool operator!=(const JSStringView& lhs, const JSString& rhs) HAL_NOEXCEPT {
+    return !(lhs == rhs);
+  }
+  
+  inline
+  std::string to_string(const JSStringView& js_string_view) {
+    return static_cast<std::string>(js_string_view);
+  }
+  
+} // namespace HAL {
+
+#endif // _HAL_JSSTRINGVIEW_HPP_
@@ -0,0 +1,172 @@
+/**
+ * HAL
+ *
+ * Copyright (c) 2014 by Appcelerator, Inc. All Rights Reserved.
+ * Licensed under the terms of the Apache Public License.
+ * Please see the LICENSE included with this distribution for details.
+ */
+
+#ifndef _HAL_JSTYPEDARRAY_HPP_
+#define _HAL_JSTYPEDARRAY_HPP_
+
+#include "HAL/detail/JSTypedArrayBase.hpp"
+#include "HAL/JSArrayBuffer.hpp"
+#include "HAL/detail/JSUtil.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace HAL { namespace detail {
+
+  // Maps a C++ element type to the JavaScript typed array type that
+  // stores it. There is no mapping for Uint8ClampedArray.
+  template<typename T>
+  struct JSTypedArrayTraits;
+
+  template<> struct JSTypedArrayTraits<std::int8_t>   { static const JSTypedArrayType type = kJSTypedArrayTypeInt8Array;    };
+  template<> struct JSTypedArrayTraits<std::uint8_t>  { static const JSTypedArrayType type = kJSTypedArrayTypeUint8Array;   };
+  template<> struct JSTypedArrayTraits<std::int16_t>  { static const JSTypedArrayType type = kJSTypedArrayTypeInt16Array;   };
+  template<> struct JSTypedArrayTraits<std::uint16_t> { static const JSTypedArrayType type = kJSTypedArrayTypeUint16Array;  };
+  template<> struct JSTypedArrayTraits<std::int32_t>  { static const JSTypedArrayType type = kJSTypedArrayTypeInt32Array;   };
+  template<> struct JSTypedArrayTraits<std::uint32_t> { static const JSTypedArrayType type = kJSTypedArrayTypeUint32Array;  };
+  template<> struct JSTypedArrayTraits<float>         { static const JSTypedArrayType type = kJSTypedArrayTypeFloat32Array; };
+  template<> struct JSTypedArrayTraits<double>        { static const JSTypedArrayType type = kJSTypedArrayTypeFloat64Array; };
+
+}} // namespace HAL { namespace detail {
+
+namespace HAL {
+
+  /*!
+   @class
+
+   @discussion A JavaScript typed array whose elements have the C++
+   type T, e.g. a JSTypedArray<float> is a Float32Array.
+
+   A JSTypedArray gives C++ direct access to its elements through
+   data(), size() and operator[], without boxing each element in a
+   JSValue. The element pointer remains valid as long as this
+   JSTypedArray is alive, unless the underlying ArrayBuffer is
+   detached by JavaScript.
+
+   The only way to create a JSTypedArray is by using the
+   JSContext::CreateTypedArray member functions, or by converting a
+   JSObject that is a typed array with the same element type.
+   */
+  template<typename T>
+  class JSTypedArray final : public detail::JSTypedArrayBase HAL_PERFORMANCE_COUNTER2(JSTypedArray<T>) {
+
+  public:
+
+    typedef T value_type;
+
+    /*!
+     @method
+
+     @abstract Return a pointer to the first element of this typed
+     array, or nullptr if it is empty or its buffer is detached.
+     */
+    T* data() const HAL_NOEXCEPT {
+      return static_cast<T*>(GetBytesPtr());
+    }
+
+    /*!
+     @method
+
+     @abstract Return the number of elements in this typed array.
+     */
+    std::size_t size() const HAL_NOEXCEPT {
+      return GetLength();
+    }
+
+    bool empty() const HAL_NOEXCEPT {
+      return size() == 0;
+    }
+
+    T* begin() const HAL_NOEXCEPT {
+      return data();
+    }
+
+    T* end() const HAL_NOEXCEPT {
+      return data() + size();
+    }
+
+    // Precondition: index < size().
+    T& operator[](std::size_t index) const HAL_NOEXCEPT {
+      return data()[index];
+    }
+
+  private:
+
+    // Only JSContext and JSObject can create a JSTypedArray.
+    friend JSContext;
+    friend JSObject;
+
+    JSTypedArray(const JSContext& js_context, std::size_t length)
+    : JSTypedArrayBase(js_context, MakeTypedArray(js_context, detail::JSTypedArrayTraits<T>::type, length), detail::JSTypedArrayTraits<T>::type) {
+    }
+
+    JSTypedArray(const JSContext& js_context, T* elements, std::size_t length, JSBytesDeallocator deallocator)
+    : JSTypedArrayBase(js_context, MakeTypedArray(js_context, detail::JSTypedArrayTraits<T>::type, elements, length * sizeof(T), std::move(deallocator)), detail::JSTypedArrayTraits<T>::type) {
+    }
+
+    JSTypedArray(const JSContext& js_context, const JSArrayBuffer& js_array_buffer, std::size_t byte_offset, std::size_t length)
+    : JSTypedArrayBase(js_context, MakeTypedArray(js_context, detail::JSTypedArrayTraits<T>::type, js_array_buffer, byte_offset, length), detail::JSTypedArrayTraits<T>::type) {
+    }
+
+    // For interoperability with the JavaScriptCore C API.
+    JSTypedArray(const JSContext& js_context, JSObjectRef js_object_ref)
+    : JSTypedArrayBase(js_context, js_object_ref, detail::JSTypedArrayTraits<T>::type) {
+    }
+  };
+
+  template<typename T>
+  JSTypedArray<T> JSContext::CreateTypedArray(std::size_t length) const {
+    return JSTypedArray<T>(*this, length);
+  }
+
+  template<typename T>
+  JSTypedArray<T> JSContext::CreateTypedArray(T* elements, std::size_t length, JSBytesDeallocator deallocator) const {
+    return JSTypedArray<T>(*this, elements, length, std::move(deallocator));
+  }
+
+  template<typename T>
+  JSTypedArray<T> JSContext::CreateTypedArray(std::vector<T> elements) const {
+    if (elements.empty()) {
+      return JSTypedArray<T>(*this, static_cast<std::size_t>(0));
+    }
+
+    // The typed array takes ownership of the vector's storage, which
+    // is freed when the typed array is garbage collected.
+    std::unique_ptr<std::vector<T>> elements_ptr(new std::vector<T>(std::move(elements)));
+    std::vector<T>* raw_elements_ptr = elements_ptr.get();
+    JSTypedArray<T> js_typed_array(*this, raw_elements_ptr -> data(), raw_elements_ptr -> size(), [raw_elements_ptr](void*) { delete raw_elements_ptr; });
+    elements_ptr.release();
+    return js_typed_array;
+  }
+
+  template<typename T>
+  JSTypedArray<T> JSContext::CreateTypedArray(const JSArrayBuffer& js_array_buffer, std::size_t byte_offset, std::size_t length) const {
+    return JSTypedArray<T>(*this, js_array_buffer, byte_offset, length);
+  }
+
+  template<typename T>
+  JSTypedArray<T> JSContext::CreateTypedArrayFromFile(const std::string& path) const {
+    const auto js_array_buffer = CreateArrayBufferFromFile(path);
+    const auto byte_length     = js_array_buffer.size();
+    if (byte_length % sizeof(T) != 0) {
+      detail::ThrowRuntimeError("JSContext", "The size of " + path + " is not a multiple of the typed array element size");
+    }
+    return JSTypedArray<T>(*this, js_array_buffer, 0, byte_length / sizeof(T));
+  }
+
+  template<typename T>
+  JSObject::operator JSTypedArray<T>() const {
+    return JSTypedArray<T>(js_context__, js_object_ref__);
+  }
+
+} // namespace HAL {
+
+#endif // _HAL_JSTYPEDARRAY_HPP_
@@ -14,9 +14,11 @@
 
 #include <vector>
 #include <ostream>
+#include <functional>
 
 namespace HAL {
   class JSString;
+  class JSONSink;
   class JSValue;
   class JSBoolean;
   class JSNumber;
@@ -26,11 +28,20 @@ namespace HAL {
   class JSDate;
   class JSError;
   class JSRegExp;
+  class JSArrayBuffer;
+  class JSException;
+  class JSValueView;
+  
+  template<typename T>
+  class JSResult;
   
   namespace detail {
     template<typename T>
     class JSExportClass;
     
+    class JSWeakMapBase;
+    class JSTypedArrayBase;
+    
     HAL_EXPORT std::vector<JSValue>    to_vector(const JSContext&, size_t, const JSValueRef[]);
     HAL_EXPORT std::vector<JSValueRef> to_vector(const std::vector<JSValue>&);
   }}
@@ -91,6 +102,32 @@ namespace HAL {
      */
     virtual JSString ToJSONString(unsigned indent = 0) final;
     
+    /*!
+     @method
+     
+     @abstract Write the JSON serialized representation of this
+     JavaScript value to a sink as UTF-8.
+     
+     @discussion Unlike ToJSONString, no JSString, std::string or
+     std::u16string copy of the JSON is made. The characters produced
+     by the engine are transcoded straight into the sink in chunks of
+     at most JSONSink::kChunkSize bytes.
+     
+     @param sink The JSONSink that receives the JSON.
+     
+     @param indent The number of spaces to indent when nesting. If 0
+     (the default), the resulting JSON will not contain newlines. The
+     size of the indent is clamped to 10 spaces.
+     
+     @result false if this JavaScript value has no JSON
+     representation (e.g. undefined or a function), in which case
+     nothing is written to the sink.
+     
+     @throws std::runtime_error if serialization threw a JavaScript
+     exception, e.g. because the object graph contains a cycle.
+     */
+    virtual bool WriteJSON(JSONSink& sink, unsigned indent = 0) const final;
+    
     /*!
      @method
      
@@ -168,6 +205,48 @@ namespace HAL {
      */
     explicit operator JSObject() const;
     
+    /*!
+     @method
+     
+     @abstract Convert this JSValue to a JSString without throwing.
+     
+     @result A JSResult holding either the JSString result of
+     conversion or the JSException thrown by the conversion. Include
+     "HAL/JSResult.hpp" to use it.
+     */
+    virtual JSResult<JSString> TryToString() const HAL_NOEXCEPT final;
+    
+    /*!
+     @method
+     
+     @abstract Convert this JSValue to a double without throwing.
+     
+     @result A JSResult holding either the double result of
+     conversion or the JSException thrown by the conversion.
+     */
+    virtual JSResult<double> TryToNumber() const HAL_NOEXCEPT final;
+    
+    /*!
+     @method
+     
+     @abstract Convert this JSValue to an int32_t according to the
+     rules specified by the JavaScript language without throwing.
+     
+     @result A JSResult holding either the int32_t result of
+     conversion or the JSException thrown by the conversion.
+     */
+    virtual JSResult<int32_t> TryToInt32() const HAL_NOEXCEPT final;
+    
+    /*!
+     @method
+     
+     @abstract Convert this JSValue to a JSObject without throwing.
+     
+     @result A JSResult holding either the JSObject result of
+     conversion or the JSException thrown by the conversion.
+     */
+    virtual JSResult<JSObject> TryToObject() const HAL_NOEXCEPT final;
+    
     /*!
      @method
      
@@ -290,6 +369,38 @@ namespace HAL {
      */
     virtual bool IsEqualWithTypeCoercion(const JSValue& js_value) const final;
     
+    /*!
+     @method
+     
+     @abstract Determine whether this JSValue refers to the very same
+     JavaScript value as another JSValue.
+     
+     @discussion Unlike operator==, which compares by the JavaScript
+     === operator, this compares the underlying JSValueRefs without
+     calling JavaScriptCore. Two objects are identical exactly when
+     they are ===, but two distinct strings with equal contents are
+     not identical.
+     
+     @param js_value The JavaScript value to test.
+     
+     @result true if both JSValues refer to the same JavaScript value.
+     */
+    virtual bool IsIdenticalTo(const JSValue& js_value) const HAL_NOEXCEPT final {
+      return js_value_ref__ == js_value.js_value_ref__ && is_native_nullptr__ == js_value.is_native_nullptr__;
+    }
+    
+    /*!
+     @method
+     
+     @abstract Return a hash of this JavaScript value's identity that
+     is consistent with IsIdenticalTo.
+     
+     @result The identity hash of this JavaScript value.
+     */
+    virtual std::size_t identity_hash_value() const HAL_NOEXCEPT final {
+      return std::hash<JSValueRef>()(js_value_ref__);
+    }
+    
     /*!
      @method
      
@@ -339,6 +450,12 @@ namespace HAL {
     template<typename T>
     friend class detail::JSExportClass;
     
+    friend class detail::JSWeakMapBase;    // for generating error messages
+    friend class JSArrayBuffer;            // for generating error messages
+    friend class detail::JSTypedArrayBase; // for generating error messages
+    friend class JSObjectTemplate;         // Instantiate
+    friend class JSValueView;              // operator JSValue()
+    
     // JSObject needs access to the JSValue constructor for
     // GetPrototype() and for generating error messages, as well as
     // operator JSValueRef() for SetPrototype().
@@ -448,6 +565,32 @@ namespace HAL {
     return ostream;
   }
   
+  /*!
+   @class
+   
+   @discussion A hash function object for using JSValues as keys in
+   unordered containers by identity, together with
+   JSValueIdentityEqual.
+   */
+  struct JSValueIdentityHash {
+    std::size_t operator()(const JSValue& js_value) const HAL_NOEXCEPT {
+      return js_value.identity_hash_value();
+    }
+  };
+  
+  /*!
+   @class
+   
+   @discussion An equality function object for using JSValues as keys
+   in unordered containers by identity, together with
+   JSValueIdentityHash.
+   */
+  struct JSValueIdentityEqual {
+    bool operator()(const JSValue& lhs, const JSValue& rhs) const HAL_NOEXCEPT {
+      return lhs.IsIdenticalTo(rhs);
+    }
+  };
+  
 } // namespace HAL {
 
 #endif // _HAL_JSVALUE_HPP_
@@ -0,0 +1,136 @@
+/**
+ * HAL
+ *
+ * Copyright (c) 2014 by Appcelerator, Inc. All Rights Reserved.
+ * Licensed under the terms of the Apache Public License.
+ * Please see the LICENSE included with this distribution for details.
+ */
+
+#ifndef _HAL_JSVALUEVIEW_HPP_
+#define _HAL_JSVALUEVIEW_HPP_
+
+#include "HAL/detail/JSBase.hpp"
+#include "HAL/JSContext.hpp"
+
+#include <cstdint>
+#include <string>
+
+namespace HAL {
+
+  class JSString;
+  class JSValue;
+  class JSObject;
+  class JSArray;
+  class JSArguments;
+
+  namespace detail {
+    template<typename T>
+    class JSExportClass;
+  }
+
+  /*!
+   @class
+
+   @discussion A JSValueView is a non-owning handle to a JavaScript
+   value that is kept alive by something else, e.g. an element of a
+   JSArray being iterated.
+
+   Unlike a JSValue, creating and copying a JSValueView neither
+   protects the value from garbage collection nor retains its
+   JSContext, so it costs no more than the JSValueRef it holds. It is
+   only valid while its owner is alive and unmodified. Convert it to a
+   JSValue to keep the value for longer.
+   */
+  class HAL_EXPORT JSValueView final {
+
+  public:
+
+    /*!
+     @method
+
+     @abstract Return the execution context of this JavaScript value.
+     */
+    JSContext get_context() const HAL_NOEXCEPT;
+
+    /*!
+     @method
+
+     @abstract Return an owning JSValue for this JavaScript value.
+     */
+    operator JSValue() const;
+
+    /*!
+     @method
+
+     @abstract Convert this JavaScript value to a JSString, a
+     std::string, a bool, a double, an int32_t or a uint32_t, with the
+     same semantics as the corresponding JSValue conversions.
+
+     @throws std::runtime_error if the conversion threw a JavaScript
+     exception.
+     */
+    explicit operator JSString() const;
+    explicit operator std::string() const;
+    explicit operator bool() const HAL_NOEXCEPT;
+    explicit operator double() const;
+    explicit operator int32_t() const;
+    explicit operator uint32_t() const;
+
+    /*!
+     @method
+
+     @abstract Convert this JavaScript value to a JSObject, with the
+     same semantics as JSValue::operator JSObject().
+
+     @throws std::runtime_error if the conversion threw a JavaScript
+     exception.
+     */
+    explicit operator JSObject() const;
+
+    /*!
+     @method
+
+     @abstract Determine the type of this JavaScript value without
+     creating a JSValue.
+     */
+    bool IsUndefined() const HAL_NOEXCEPT;
+    bool IsNull()      const HAL_NOEXCEPT;
+    bool IsBoolean()   const HAL_NOEXCEPT;
+    bool IsNumber()    const HAL_NOEXCEPT;
+    bool IsString()    const HAL_NOEXCEPT;
+    bool IsObject()    const HAL_NOEXCEPT;
+
+  private:
+
+    // Only the following classes can create a JSValueView.
+    friend class JSArray;
+    friend class JSObject;
+    friend class JSArguments;
+
+    // JSExportClass converts the arguments of native functions.
+    template<typename T>
+    friend class detail::JSExportClass;
+
+    JSValueView(JSContextRef js_context_ref, JSValueRef js_value_ref) HAL_NOEXCEPT
+    : js_context_ref__(js_context_ref)
+    , js_value_ref__(js_value_ref) {
+    }
+
+    // JSArray needs access to operator JSValueRef() to copy a range
+    // of views into a new Array.
+    explicit operator JSValueRef() const HAL_NOEXCEPT {
+      return js_value_ref__;
+    }
+
+    // Silence 4251 on Windows since private member variables do not
+    // need to be exported from a DLL.
+#pragma warning(push)
+#pragma warning(disable: 4251)
+    JSContextRef js_context_ref__ { nullptr };
+    JSValueRef   js_value_ref__   { nullptr };
+#pragma warning(pop)
+  };
+
+} // namespace HAL {
+
+#endif // _HAL_JSVALUEVIEW_HPP_
@@ -0,0 +1,148 @@
+/**
+ * HAL
+ *
+ * Copyright (c) 2014 by Appcelerator, Inc. All Rights Reserved.
+ * Licensed under the terms of the Apache Public License.
+ * Please see the LICENSE included with this distribution for details.
+ */
+
+#ifndef _HAL_JSVECTORVIEW_HPP_
+#define _HAL_JSVECTORVIEW_HPP_
+
+#include "HAL/JSExport.hpp"
+#include "HAL/JSExportObject.hpp"
+#include "HAL/JSContext.hpp"
+#include "HAL/JSValue.hpp"
+#include "HAL/JSObject.hpp"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace HAL { namespace detail {
+
+  // Converts an element of a JSVectorView<E> to and from a JSValue.
+  template<typename E>
+  struct JSVectorViewTraits;
+
+  template<>
+  struct JSVectorViewTraits<double> {
+    static JSValue ToJSValue(const JSContext& js_context, double element) {
+      return js_context.CreateNumber(element);
+    }
+    static double FromJSValue(const JSValue& js_value) {
+      return static_cast<double>(js_value);
+    }
+  };
+
+  template<>
+  struct JSVectorViewTraits<int> {
+    static JSValue ToJSValue(const JSContext& js_context, int element) {
+      return js_context.CreateNumber(static_cast<std::int32_t>(element));
+    }
+    static int FromJSValue(const JSValue& js_value) {
+      return static_cast<std::int32_t>(js_value);
+    }
+  };
+
+  template<>
+  struct JSVectorViewTraits<std::string> {
+    static JSValue ToJSValue(const JSContext& js_context, const std::string& element) {
+      return js_context.CreateString(element);
+    }
+    static std::string FromJSValue(const JSValue& js_value) {
+      return static_cast<std::string>(js_value);
+    }
+  };
+
+}} // namespace HAL { namespace detail {
+
+namespace HAL {
+
+  /*!
+   @class
+
+   @discussion A JSVectorView exposes a native std::vector<E> to
+   JavaScript as an Array-like object, by reference. E may be double,
+   int or std::string.
+
+   JavaScript reads obj.length and obj[i] straight from the vector,
+   and obj[i] = value writes straight into it, so the vector is never
+   copied into a JavaScript Array. Assigning to an index at or beyond
+   the length does not grow the vector; it adds an ordinary property
+   to the JavaScript object instead.
+
+   The vector is not owned by the JavaScript object. The caller must
+   keep it alive, and must not move it, for as long as JavaScript can
+   reach the object.
+
+   Example:
+
+   std::vector<double> samples = ...;
+   js_context.get_global_object().SetProperty("samples", JSVectorView<double>::Create(js_context, samples));
+   */
+  template<typename E>
+  class JSVectorView final : public JSExportObject, public JSExport<JSVectorView<E>> {
+
+  public:
+
+    /*!
+     @method
+
+     @abstract Create a JavaScript object that is a view of elements.
+
+     @param js_context The execution context to create the object in.
+
+     @param elements The vector to expose to JavaScript, which must
+     outlive the returned object.
+
+     @result A JavaScript object whose indexes and length are those of
+     elements.
+     */
+    static JSObject Create(const JSContext& js_context, std::vector<E>& elements) {
+      auto js_object = js_context.CreateObject(JSExport<JSVectorView<E>>::Class());
+      js_object.template GetPrivate<JSVectorView<E>>() -> elements__ = &elements;
+      return js_object;
+    }
+
+    JSVectorView(const JSContext& js_context) HAL_NOEXCEPT
+    : JSExportObject(js_context) {
+    }
+
+    static void JSExportInitialize() {
+      JSExport<JSVectorView<E>>::SetClassVersion(1);
+      JSExport<JSVectorView<E>>::SetParent(JSExport<JSExportObject>::Class());
+      JSExport<JSVectorView<E>>::AddIndexedGetCallback(std::mem_fn(&JSVectorView<E>::GetElement));
+      JSExport<JSVectorView<E>>::AddIndexedSetCallback(std::mem_fn(&JSVectorView<E>::SetElement));
+      JSExport<JSVectorView<E>>::AddLengthCallback(std::mem_fn(&JSVectorView<E>::GetLength));
+    }
+
+  private:
+
+    JSValue GetElement(unsigned index) const {
+      if (!elements__ || index >= elements__ -> size()) {
+        return get_context().CreateNativeNull();
+      }
+      return detail::JSVectorViewTraits<E>::ToJSValue(get_context(), (*elements__)[index]);
+    }
+
+    bool SetElement(unsigned index, const JSValue& js_value) {
+      if (!elements__ || index >= elements__ -> size()) {
+        return false;
+      }
+      (*elements__)[index] = detail::JSVectorViewTraits<E>::FromJSValue(js_value);
+      return true;
+    }
+
+    unsigned GetLength() const {
+      return elements__ ? static_cast<unsigned>(elements__ -> size()) : 0;
+    }
+
+    // The vector is owned by the caller of Create. It is nullptr if
+    // JavaScript created this object with 'new'.
+    std::vector<E>* elements__ { nullptr };
+  };
+
+} // namespace HAL {
+
+#endif // _HAL_JSVECTORVIEW_HPP_
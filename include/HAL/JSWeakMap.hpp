@@ -0,0 +1,192 @@
+/**
+ * HAL
+ *
+ * Copyright (c) 2014 by Appcelerator, Inc. All Rights Reserved.
+ * Licensed under the terms of the Apache Public License.
+ * Please see the LICENSE included with this distribution for details.
+ */
+
+#ifndef _HAL_JSWEAKMAP_HPP_
+#define _HAL_JSWEAKMAP_HPP_
+
+#include "HAL/detail/JSBase.hpp"
+#include "HAL/detail/JSWeakMapBase.hpp"
+#include "HAL/JSObject.hpp"
+
+#include <memory>
+#include <unordered_map>
+#include <utility>
+
+namespace HAL {
+  template<typename T>
+  class JSWeakMap;
+}
+
+namespace HAL { namespace detail {
+
+  template<typename T>
+  class JSWeakMapTable final : public JSWeakMapBase {
+
+  public:
+
+    JSWeakMapTable()                       = default;
+    virtual ~JSWeakMapTable() HAL_NOEXCEPT = default;
+
+  private:
+
+    template<typename U>
+    friend class HAL::JSWeakMap;
+
+    virtual void Finalize(std::intptr_t key) HAL_NOEXCEPT override final {
+      values__.erase(key);
+    }
+
+    std::unordered_map<std::intptr_t, T> values__;
+  };
+
+}} // namespace HAL { namespace detail {
+
+namespace HAL {
+
+  /*!
+   @class
+
+   @discussion A JSWeakMap is a native side table that associates a
+   value of type T with JavaScript objects, like the JavaScript
+   WeakMap. Keys are compared by identity and are held weakly: an
+   entry is removed automatically when its JavaScript object is
+   garbage collected, and the map never protects its keys.
+
+   To learn when a key is collected, JSWeakMap attaches a
+   non-enumerable property to it. Keys must therefore accept new
+   properties.
+
+   Values must not refer back to their key (e.g. hold a JSObject of
+   it), otherwise the key can never be collected.
+   */
+  template<typename T>
+  class JSWeakMap final {
+
+  public:
+
+    JSWeakMap()
+    : table__(std::make_shared<detail::JSWeakMapTable<T>>()) {
+    }
+
+    /*!
+     @method
+
+     @abstract Associate a value with a JavaScript object, replacing
+     any value already associated with it.
+
+     @result true if a new entry was inserted, false if an existing
+     value was replaced.
+
+     @throws std::invalid_argument if js_object does not accept new
+     properties, e.g. because it is frozen.
+     */
+    bool Set(const JSObject& js_object, T value) {
+      const auto key = table__ -> Attach(js_object);
+      auto& values = table__ -> values__;
+      const auto position = values.find(key);
+      if (position != values.end()) {
+        position -> second = std::move(value);
+        return false;
+      }
+      values.emplace(key, std::move(value));
+      return true;
+    }
+
+    /*!
+     @method
+
+     @abstract Return a pointer to the value associated with a
+     JavaScript object, or nullptr if there is none. The pointer is
+     invalidated by any other call on this JSWeakMap and by the
+     collection of the key.
+     */
+    T* Find(const JSObject& js_object) {
+      if (!table__ -> IsAttached(js_object)) {
+        return nullptr;
+      }
+      auto& values = table__ -> values__;
+      const auto position = values.find(detail::JSWeakMapBase::GetKey(js_object));
+      return position != values.end() ? &position -> second : nullptr;
+    }
+
+    /*!
+     @method
+
+     @abstract Determine whether a value is associated with a
+     JavaScript object.
+     */
+    bool Contains(const JSObject& js_object) {
+      return Find(js_object) != nullptr;
+    }
+
+    /*!
+     @method
+
+     @abstract Remove the value associated with a JavaScript object.
+
+     @result true if a value was removed.
+     */
+    bool Erase(const JSObject& js_object) {
+      if (!table__ -> Detach(js_object)) {
+        return false;
+      }
+      return table__ -> values__.erase(detail::JSWeakMapBase::GetKey(js_object)) > 0;
+    }
+
+    /*!
+     @method
+
+     @abstract Remove every entry.
+     */
+    void clear() HAL_NOEXCEPT {
+      table__ -> DetachAll();
+      table__ -> values__.clear();
+    }
+
+    /*!
+     @method
+
+     @abstract Return the number of entries, including entries whose
+     key has been collected but not yet finalized.
+     */
+    std::size_t size() const HAL_NOEXCEPT {
+      return table__ -> values__.size();
+    }
+
+    bool empty() const HAL_NOEXCEPT {
+      return table__ -> values__.empty();
+    }
+
+    ~JSWeakMap()                                   = default;
+    JSWeakMap(const JSWeakMap&)                    = delete;
+    JSWeakMap& operator=(const JSWeakMap&)         = delete;
+    JSWeakMap(JSWeakMap&& rhs) HAL_NOEXCEPT
+    : table__(std::move(rhs.table__)) {
+    }
+    JSWeakMap& operator=(JSWeakMap&& rhs) HAL_NOEXCEPT {
+      swap(rhs);
+      return *this;
+    }
+    void swap(JSWeakMap& other) HAL_NOEXCEPT {
+      using std::swap;
+      swap(table__, other.table__);
+    }
+
+  private:
+
+    std::shared_ptr<detail::JSWeakMapTable<T>> table__;
+  };
+
+  template<typename T>
+  void swap(JSWeakMap<T>& first, JSWeakMap<T>& second) HAL_NOEXCEPT {
+    first.swap(second);
+  }
+
+} // namespace HAL {
+
+#endif // _HAL_JSWEAKMAP_HPP_
@@ -17,8 +17,15 @@
 // #define HAL_THREAD_SAFE
 
 #define HAL_NOEXCEPT_ENABLE
+#define HAL_CONSTEXPR_ENABLE
 #define HAL_MOVE_CTOR_AND_ASSIGN_DEFAULT_ENABLE
 
+// JSObject::IsArray uses the JSValueIsArray predicate of the
+// JavaScriptCore C API. Comment this out when linking against a
+// JavaScriptCore that doesn't export it, in which case the cached
+// Array.isArray builtin is called instead.
+#define HAL_JSVALUE_IS_ARRAY_ENABLE
+
 // See http://msdn.microsoft.com/en-us/library/b0084kay.aspx for the
 // list of Visual C++ "Predefined Macros". Visual Studio 2013 Update 3
 // RTM ships with MSVC 18.0.30723.0
@@ -40,6 +47,7 @@
 // http://blogs.msdn.com/b/vcblog/archive/2013/12/02/c-11-14-core-language-features-in-vs-2013-and-the-nov-2013-ctp.aspx
 
 #undef HAL_NOEXCEPT_ENABLE
+#undef HAL_CONSTEXPR_ENABLE
 #undef HAL_MOVE_CTOR_AND_ASSIGN_DEFAULT_ENABLE
 
 #endif  // #defined(_MSC_VER) && _MSC_VER <= 1800
@@ -50,6 +58,13 @@
 #define HAL_NOEXCEPT
 #endif
 
+// Visual Studio 2013 doesn't support constexpr.
+#ifdef HAL_CONSTEXPR_ENABLE
+#define HAL_CONSTEXPR constexpr
+#else
+#define HAL_CONSTEXPR
+#endif
+
 #ifdef HAL_THREAD_SAFE
 #include <mutex>
 #endif
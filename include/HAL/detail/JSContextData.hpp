@@ -0,0 +1,68 @@
+/**
+ * HAL
+ *
+ * Copyright (c) 2014 by Appcelerator, Inc. All Rights Reserved.
+ * Licensed under the terms of the Apache Public License.
+ * Please see the LICENSE included with this distribution for details.
+ */
+
+#ifndef _HAL_DETAIL_JSCONTEXTDATA_HPP_
+#define _HAL_DETAIL_JSCONTEXTDATA_HPP_
+
+#include "HAL/detail/JSBase.hpp"
+
+#include <cstddef>
+
+namespace HAL {
+  class JSContext;
+}
+
+namespace HAL { namespace detail {
+
+  class JSContextValueCache;
+
+  /*!
+   @class
+
+   @discussion The state shared by every JSContext that refers to the
+   same JSGlobalContextRef. It holds the single JSGlobalContextRetain
+   on behalf of all of them, so copying a JSContext only increments
+   reference_count__.
+
+   The per-context caches (e.g. the preallocated undefined, null,
+   boolean and small integer values) hold JSContexts themselves. Those
+   references are tallied in cached_reference_count__ so that the
+   caches can be destroyed as soon as only they remain, which in turn
+   releases the JSGlobalContextRef.
+
+   Only JSContext creates, retains and releases a JSContextData.
+   */
+  class JSContextData final {
+
+  public:
+
+    JSGlobalContextRef get_global_context_ref() const HAL_NOEXCEPT {
+      return js_global_context_ref__;
+    }
+
+  private:
+
+    friend class HAL::JSContext;
+
+    explicit JSContextData(JSGlobalContextRef js_global_context_ref) HAL_NOEXCEPT
+    : js_global_context_ref__(js_global_context_ref) {
+    }
+
+    ~JSContextData()                               = default;
+    JSContextData(const JSContextData&)            = delete;
+    JSContextData& operator=(const JSContextData&) = delete;
+
+    JSGlobalContextRef   js_global_context_ref__ { nullptr };
+    std::size_t          reference_count__        { 0 };
+    std::size_t          cached_reference_count__ { 0 };
+    JSContextValueCache* value_cache__            { nullptr };
+  };
+
+}} // namespace HAL { namespace detail {
+
+#endif // _HAL_DETAIL_JSCONTEXTDATA_HPP_
@@ -0,0 +1,97 @@
+/**
+ * HAL
+ *
+ * Copyright (c) 2014 by Appcelerator, Inc. All Rights Reserved.
+ * Licensed under the terms of the Apache Public License.
+ * Please see the LICENSE included with this distribution for details.
+ */
+
+#ifndef _HAL_DETAIL_JSCONTEXTVALUECACHE_HPP_
+#define _HAL_DETAIL_JSCONTEXTVALUECACHE_HPP_
+
+#include "HAL/detail/JSBase.hpp"
+
+#include "HAL/JSUndefined.hpp"
+#include "HAL/JSNull.hpp"
+#include "HAL/JSBoolean.hpp"
+#include "HAL/JSNumber.hpp"
+#include "HAL/JSObject.hpp"
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace HAL { namespace detail {
+
+  /*!
+   @struct
+
+   @discussion The global object and the builtins that HAL itself
+   uses, looked up once per execution context. Because they are the
+   original builtins, scripts that later replace e.g. the global Error
+   don't change the outcome of HAL's brand checks. A builtin that
+   wasn't an object when it was looked up is undefined.
+   */
+  struct JSContextBuiltins final {
+
+    JSContextBuiltins(const JSObject& global_object, const JSValue& error_constructor, const JSValue& array_is_array) HAL_NOEXCEPT
+    : global_object(global_object)
+    , error_constructor(error_constructor)
+    , array_is_array(array_is_array) {
+    }
+
+    JSContextBuiltins(const JSContextBuiltins&)            = delete;
+    JSContextBuiltins& operator=(const JSContextBuiltins&) = delete;
+
+    JSObject global_object;
+    JSValue  error_constructor;
+    JSValue  array_is_array;
+  };
+
+  /*!
+   @class
+
+   @discussion The preallocated JavaScript values of one execution
+   context, handed out by const reference from the JSContext::get_XXX
+   member functions. The small integers, the builtins and the iterator
+   factory are only created the first time one of them is asked for.
+
+   Only JSContext creates a JSContextValueCache.
+   */
+  class JSContextValueCache final {
+
+  public:
+
+    JSContextValueCache(const JSUndefined& js_undefined, const JSNull& js_null, const JSBoolean& js_false, const JSBoolean& js_true) HAL_NOEXCEPT
+    : js_undefined__(js_undefined)
+    , js_null__(js_null)
+    , js_false__(js_false)
+    , js_true__(js_true) {
+    }
+
+    JSContextValueCache(const JSContextValueCache&)            = delete;
+    JSContextValueCache& operator=(const JSContextValueCache&) = delete;
+
+  private:
+
+    friend class HAL::JSContext;
+
+    JSUndefined js_undefined__;
+    JSNull      js_null__;
+    JSBoolean   js_false__;
+    JSBoolean   js_true__;
+
+    // js_numbers__[i] holds the number first_number__ + i.
+    std::int32_t          first_number__ { 0 };
+    std::vector<JSNumber> js_numbers__;
+
+    std::unique_ptr<JSContextBuiltins> js_builtins__;
+
+    // The function that JSContext::CreateIterable calls to create the
+    // JavaScript half of an iterable, compiled once per context.
+    std::unique_ptr<JSObject> js_iterator_factory__;
+  };
+
+}} // namespace HAL { namespace detail {
+
+#endif // _HAL_DETAIL_JSCONTEXTVALUECACHE_HPP_
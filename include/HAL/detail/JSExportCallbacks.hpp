@@ -11,6 +11,10 @@
 
 #include "HAL/JSValue.hpp"
 
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+#include <type_traits>
 #include <vector>
 
 namespace HAL {
@@ -378,6 +382,176 @@ namespace HAL { namespace detail {
   template<typename T>
   using ConvertToTypeCallback = std::function<JSValue(const T&, ::HAL::JSValue::Type&)>;
   
+  /*!
+   @typedef GetIndexedPropertyCallback
+   
+   @abstract The callback to invoke when getting the value of an array
+   index property (e.g. obj[0]) from your JavaScript object.
+   
+   @discussion The array index is parsed from the property name
+   without converting it to a std::string first. If this callback
+   returns native null value (context.CreateNativeNull()), e.g. because
+   the index is out of range, then the get request forwards to your
+   JavaScript object's GetPropertyCallback (if any), then properties
+   vended by your class' parent class chain, then properties belonging
+   to your JavaScript object's prototype chain.
+   
+   For example, given this class definition:
+   
+   class Foo {
+   JSValue GetElement(unsigned index) const;
+   };
+   
+   You would define the callback like this:
+   
+   GetIndexedPropertyCallback callback(&Foo::GetElement);
+   
+   @param 1 A const reference to the C++ object that implements your
+   JavaScript object.
+   
+   @param 2 The array index.
+   
+   @result The value at the array index, or native null value to
+   forward the request.
+   */
+  template<typename T>
+  using GetIndexedPropertyCallback = std::function<JSValue(const T&, unsigned)>;
+  
+  /*!
+   @typedef SetIndexedPropertyCallback
+   
+   @abstract The callback to invoke when setting the value of an array
+   index property (e.g. obj[0] = 1) on your JavaScript object.
+   
+   @discussion If this callback returns false then the request
+   forwards to your JavaScript object's SetPropertyCallback (if any),
+   then properties vended by your class' parent class chain, then
+   properties belonging to your JavaScript object's prototype chain.
+   
+   For example, given this class definition:
+   
+   class Foo {
+   bool SetElement(unsigned index, const JSValue& value);
+   };
+   
+   You would define the callback like this:
+   
+   SetIndexedPropertyCallback callback(&Foo::SetElement);
+   
+   @param 1 A non-const reference to the C++ object that implements
+   your JavaScript object.
+   
+   @param 2 The array index.
+   
+   @param 3 A const reference to the property's value.
+   
+   @result Return true to indicate that the value was set.
+   */
+  template<typename T>
+  using SetIndexedPropertyCallback = std::function<bool(T&, unsigned, const JSValue&)>;
+  
+  /*!
+   @typedef GetLengthCallback
+   
+   @abstract The callback to invoke when getting the 'length' property
+   of your JavaScript object.
+   
+   @discussion For example, given this class definition:
+   
+   class Foo {
+   unsigned GetLength() const;
+   };
+   
+   You would define the callback like this:
+   
+   GetLengthCallback callback(&Foo::GetLength);
+   
+   @param 1 A const reference to the C++ object that implements your
+   JavaScript object.
+   
+   @result The number of array index properties of your JavaScript
+   object.
+   */
+  template<typename T>
+  using GetLengthCallback = std::function<unsigned(const T&)>;
+  
+  /*!
+   @struct NativeMemberFunctionTraits
+   
+   @abstract The object, result and argument types of a pointer to a
+   member function with a natural C++ signature, e.g.
+   
+   double (Foo::*)(double, int32_t, const std::string&)
+   
+   @discussion JSExportClass uses these to convert the arguments of a
+   JavaScript function call directly from the JavaScriptCore argument
+   array, and its result back to a JavaScript value, without building
+   a std::vector<JSValue>.
+   */
+  template<typename F>
+  struct NativeMemberFunctionTraits;
+  
+  template<typename T, typename R, typename... Args>
+  struct NativeMemberFunctionTraits<R (T::*)(Args...)> {
+    using object_type    = T;
+    using result_type    = R;
+    using argument_tuple = std::tuple<typename std::decay<Args>::type...>;
+    
+    template<std::size_t I>
+    using argument_type = typename std::tuple_element<I, std::tuple<Args...>>::type;
+  };
+  
+  template<typename T, typename R, typename... Args>
+  struct NativeMemberFunctionTraits<R (T::*)(Args...) const> : NativeMemberFunctionTraits<R (T::*)(Args...)> {
+  };
+  
+  /*!
+   @struct NativeDataMemberTraits
+   
+   @abstract The object and member types of a pointer to a data
+   member, e.g. double Foo::*, and the type its value is converted
+   through to and from a JavaScript value.
+   
+   @discussion bool members become JavaScript booleans. Floating
+   point members become numbers through double, and integral members
+   of up to 32 bits become numbers through int32_t or uint32_t, with
+   the ECMA-262 ToInt32 and ToUint32 semantics when set. std::string,
+   JSString and JSValue members are converted as themselves. A const
+   member is read-only.
+   */
+  template<typename F>
+  struct NativeDataMemberTraits;
+  
+  template<typename T, typename U>
+  struct NativeDataMemberTraits<U T::*> {
+    using object_type = T;
+    using member_type = typename std::remove_const<U>::type;
+    using is_const    = std::is_const<U>;
+    
+    static_assert(!std::is_integral<member_type>::value || sizeof(member_type) <= sizeof(std::int32_t), "Integral data members wider than 32 bits can't be represented exactly by a JavaScript number");
+    
+    using value_type = typename std::conditional<std::is_same<member_type, bool>::value     , bool,
+                       typename std::conditional<std::is_floating_point<member_type>::value, double,
+                       typename std::conditional<std::is_integral<member_type>::value,
+                       typename std::conditional<std::is_signed<member_type>::value, std::int32_t, std::uint32_t>::type,
+                       member_type>::type>::type>::type;
+  };
+  
+  // A compile-time sequence of argument indexes, since C++11 lacks
+  // std::index_sequence.
+  template<std::size_t... Indexes>
+  struct IndexSequence {
+  };
+  
+  template<std::size_t N, std::size_t... Indexes>
+  struct MakeIndexSequence : MakeIndexSequence<N - 1, N - 1, Indexes...> {
+  };
+  
+  template<std::size_t... Indexes>
+  struct MakeIndexSequence<0, Indexes...> {
+    using type = IndexSequence<Indexes...>;
+  };
+  
 }} // namespace HAL { namespace detail {
 
 #endif // _HAL_DETAIL_JSEXPORTCALLBACKS_HPP_
@@ -15,6 +15,9 @@
 
 #include "HAL/JSString.hpp"
 #include "HAL/JSValue.hpp"
+#include "HAL/JSValueView.hpp"
+#include "HAL/JSArguments.hpp"
+#include "HAL/JSExportAllocator.hpp"
 #include "HAL/JSObject.hpp"
 #include "HAL/JSNumber.hpp"
 #include "HAL/JSError.hpp"
@@ -30,6 +33,8 @@
 #include <vector>
 #include <memory>
 #include <utility>
+#include <tuple>
+#include <type_traits>
 #include <typeinfo>
 #include <typeindex>
 
@@ -40,6 +45,20 @@ namespace HAL {
 
 namespace HAL { namespace detail {
   
+  /*!
+   @function
+   
+   @abstract Destroy the native object that the initialize callback
+   of a parent JSExport class created for an object that is now being
+   initialized as an object of a derived class, and give its storage
+   back to the pool it came from, if any.
+   
+   @discussion The type of the native object isn't known at that
+   point, so it is destroyed through the virtual destructor of
+   JSExportObject, which must be the first base class of every parent
+   JSExport class.
+   */
+  HAL_EXPORT void DestroyReplacedNativeObject(void* native_object_ptr) HAL_NOEXCEPT;
   
   template<typename T>
   class JSExportClassDefinitionBuilder;
@@ -90,13 +109,96 @@ namespace HAL { namespace detail {
     template<typename U>
     friend class JSExportClassDefinitionBuilder;
     
-    // Support for JSStaticValue
+    // Support for JSStaticValue. JSExportClassDefinition installs the
+    // thunk for each property's index in named_value_properties__,
+    // which never examines the property name. Properties past the
+    // last thunk share the callbacks that find the index by name.
     static JSValueRef  GetNamedValuePropertyCallback(JSContextRef context_ref, JSObjectRef object_ref, JSStringRef property_name_ref, JSValueRef* exception);
     static bool        SetNamedValuePropertyCallback(JSContextRef context_ref, JSObjectRef object_ref, JSStringRef property_name_ref, JSValueRef value_ref, JSValueRef* exception);
+    static JSValueRef  GetNamedValueProperty(std::size_t index, JSContextRef context_ref, JSObjectRef object_ref, JSValueRef* exception);
+    static bool        SetNamedValueProperty(std::size_t index, JSContextRef context_ref, JSObjectRef object_ref, JSValueRef value_ref, JSValueRef* exception);
+    
+    template<std::size_t Index>
+    static JSValueRef  GetNamedValuePropertyThunk(JSContextRef context_ref, JSObjectRef object_ref, JSStringRef, JSValueRef* exception) {
+      return GetNamedValueProperty(Index, context_ref, object_ref, exception);
+    }
+    
+    template<std::size_t Index>
+    static bool        SetNamedValuePropertyThunk(JSContextRef context_ref, JSObjectRef object_ref, JSStringRef, JSValueRef value_ref, JSValueRef* exception) {
+      return SetNamedValueProperty(Index, context_ref, object_ref, value_ref, exception);
+    }
+    
+    template<std::size_t... Indexes>
+    static const ::JSObjectGetPropertyCallback* GetNamedValuePropertyThunks(IndexSequence<Indexes...>) HAL_NOEXCEPT {
+      static const ::JSObjectGetPropertyCallback thunks[] = { &JSExportClass<T>::template GetNamedValuePropertyThunk<Indexes>... };
+      return thunks;
+    }
+    
+    template<std::size_t... Indexes>
+    static const ::JSObjectSetPropertyCallback* SetNamedValuePropertyThunks(IndexSequence<Indexes...>) HAL_NOEXCEPT {
+      static const ::JSObjectSetPropertyCallback thunks[] = { &JSExportClass<T>::template SetNamedValuePropertyThunk<Indexes>... };
+      return thunks;
+    }
     
     // Support for JSStaticFunction
     static JSValueRef  CallNamedFunctionCallback(JSContextRef context_ref, JSObjectRef function_ref, JSObjectRef this_object_ref, size_t argument_count, const JSValueRef arguments_array[], JSValueRef* exception);
     
+    // Support for JSStaticValue and JSStaticFunction through member
+    // functions known at compile time. JavaScriptCore calls these
+    // thunks directly, so there is no property name lookup and no
+    // std::function call.
+    template<JSValue (T::*Getter)() const>
+    static JSValueRef  GetMemberValueThunk(JSContextRef context_ref, JSObjectRef object_ref, JSStringRef property_name_ref, JSValueRef* exception);
+    template<bool (T::*Setter)(const JSValue&)>
+    static bool        SetMemberValueThunk(JSContextRef context_ref, JSObjectRef object_ref, JSStringRef property_name_ref, JSValueRef value_ref, JSValueRef* exception);
+    template<JSValue (T::*Method)(const std::vector<JSValue>&, JSObject&)>
+    static JSValueRef  CallMemberFunctionThunk(JSContextRef context_ref, JSObjectRef function_ref, JSObjectRef this_object_ref, size_t argument_count, const JSValueRef arguments_array[], JSValueRef* exception);
+    template<JSValue (T::*Method)(const JSArguments&, JSObject&)>
+    static JSValueRef  CallArgumentsFunctionThunk(JSContextRef context_ref, JSObjectRef function_ref, JSObjectRef this_object_ref, size_t argument_count, const JSValueRef arguments_array[], JSValueRef* exception);
+    
+    // Support for calling the JavaScript object itself through a
+    // member function known at compile time.
+    template<JSValue (T::*Method)(const JSArguments&, JSObject&)>
+    static JSValueRef  CallAsFunctionArgumentsThunk(JSContextRef context_ref, JSObjectRef function_ref, JSObjectRef this_object_ref, size_t argument_count, const JSValueRef arguments_array[], JSValueRef* exception);
+    
+    // Support for JSStaticValue through data members of T, or of a
+    // base class of T.
+    template<typename F, F Field>
+    static JSValueRef  GetDataMemberThunk(JSContextRef context_ref, JSObjectRef object_ref, JSStringRef property_name_ref, JSValueRef* exception);
+    template<typename F, F Field>
+    static bool        SetDataMemberThunk(JSContextRef context_ref, JSObjectRef object_ref, JSStringRef property_name_ref, JSValueRef value_ref, JSValueRef* exception);
+    template<typename F, F Field>
+    static ::JSObjectSetPropertyCallback GetDataMemberSetThunk(std::false_type /* is_const */) HAL_NOEXCEPT {
+      return &JSExportClass<T>::template SetDataMemberThunk<F, Field>;
+    }
+    template<typename F, F Field>
+    static ::JSObjectSetPropertyCallback GetDataMemberSetThunk(std::true_type /* is_const */) HAL_NOEXCEPT {
+      return nullptr;
+    }
+    
+    // Support for JSStaticFunction through member functions with a
+    // natural C++ signature. The arguments are converted straight
+    // from arguments_array and the result straight to a JSValueRef.
+    template<typename F, F Method>
+    static JSValueRef  CallNativeFunctionThunk(JSContextRef context_ref, JSObjectRef function_ref, JSObjectRef this_object_ref, size_t argument_count, const JSValueRef arguments_array[], JSValueRef* exception);
+    template<typename F, F Method, std::size_t... Indexes>
+    static JSValueRef  CallNativeFunction(T& native_object, JSContextRef context_ref, const JSValueRef arguments_array[], IndexSequence<Indexes...>);
+    template<typename Callable>
+    static JSValueRef  CallNativeFunction(JSContextRef context_ref, Callable&& callable, std::true_type returns_void);
+    template<typename Callable>
+    static JSValueRef  CallNativeFunction(JSContextRef context_ref, Callable&& callable, std::false_type returns_void);
+    
+    // Convert the result of a member function with a natural C++
+    // signature to a JSValueRef.
+    static JSValueRef  ToJSValueRef(JSContextRef context_ref, bool               result);
+    static JSValueRef  ToJSValueRef(JSContextRef context_ref, double             result);
+    static JSValueRef  ToJSValueRef(JSContextRef context_ref, int32_t            result);
+    static JSValueRef  ToJSValueRef(JSContextRef context_ref, uint32_t           result);
+    static JSValueRef  ToJSValueRef(JSContextRef context_ref, const char*        result);
+    static JSValueRef  ToJSValueRef(JSContextRef context_ref, const std::string& result);
+    static JSValueRef  ToJSValueRef(JSContextRef context_ref, const JSString&    result);
+    static JSValueRef  ToJSValueRef(JSContextRef context_ref, const JSValue&     result);
+    
     // JavaScriptCore C API callback interface.
     static void        JSObjectInitializeCallback(JSContextRef context_ref, JSObjectRef object_ref);
     static void        JSObjectFinalizeCallback(JSObjectRef object_ref);
@@ -111,9 +213,9 @@ namespace HAL { namespace detail {
     static JSValueRef  JSObjectConvertToTypeCallback(JSContextRef context_ref, JSObjectRef object_ref, JSType type, JSValueRef* exception);
     
     // Helper functions.
-    static JSValue CreateJSError(const std::string& function_name, const std::string& location, JSObject js_object, const js_runtime_error& e);
-    static JSValue CreateJSError(const std::string& function_name, JSObject js_object, const std::exception& e);
-    static JSValue CreateJSError(const std::string& function_name, JSObject js_object, const std::string& what);
+    static JSValue CreateJSError(const std::string& function_name, const std::string& location, const JSObject& js_object, const js_runtime_error& e);
+    static JSValue CreateJSError(const std::string& function_name, const JSObject& js_object, const std::exception& e);
+    static JSValue CreateJSError(const std::string& function_name, const JSObject& js_object, const std::string& what);
     static std::string GetJSExportComponentName(const std::string& function_name, const std::string& location = "");
     
     static JSExportClassDefinition<T> js_export_class_definition__;
@@ -157,9 +259,9 @@ namespace HAL { namespace detail {
   template<typename T>
   void JSExportClass<T>::Print() const {
     HAL_JSCLASS_LOCK_GUARD;
-    for (const auto& entry : js_export_class_definition__.named_value_property_callback_map__) {
-      const auto& name       = entry.first;
-      const auto& attributes = entry.second.get_attributes();
+    for (const auto& entry : js_export_class_definition__.named_value_properties__) {
+      const auto& name       = entry.name;
+      const auto& attributes = entry.callback.get_attributes();
       HAL_LOG_DEBUG("JSExportClass: has value property callback ", name, " with attributes ", to_string(attributes));
     }
     
@@ -179,12 +281,12 @@ namespace HAL { namespace detail {
     JSObject js_object(JSContext(context_ref), object_ref);
     HAL_LOG_DEBUG("JSExportClass<", typeid(T).name(), ">::Initialize: JSContextRef = ", context_ref, ", JSObjectRef = ", object_ref);
 
-    const auto previous_native_object_ptr = static_cast<JSExport<T>*>(js_object.GetPrivate());
-    const auto native_object_ptr          = new T(js_object.get_context());
+    const auto previous_native_object_ptr = js_object.GetPrivate();
+    const auto native_object_ptr          = JSExportAllocator<T>::Create(js_object.get_context());
     
     if (previous_native_object_ptr != nullptr) {
       HAL_LOG_DEBUG("JSExportClass<", typeid(T).name(), ">::Initialize: replace ", previous_native_object_ptr, " with ", native_object_ptr, " for ", object_ref);
-      delete previous_native_object_ptr;
+      DestroyReplacedNativeObject(previous_native_object_ptr);
     }
     
     const bool result = js_object.SetPrivate(native_object_ptr);
@@ -199,93 +301,96 @@ namespace HAL { namespace detail {
   void JSExportClass<T>::JSObjectFinalizeCallback(JSObjectRef object_ref) {
     HAL_DETAIL_JSEXPORTCLASS_LOCK_GUARD_STATIC;
     
-    auto native_object_ptr = static_cast<JSExport<T>*>(JSObjectGetPrivate(object_ref));
+    auto native_object_ptr = static_cast<T*>(JSObjectGetPrivate(object_ref));
     
-    HAL_LOG_DEBUG("JSExportClass<", typeid(T).name(), ">::Finalize: delete native object ", native_object_ptr, " for ", object_ref);
+    HAL_LOG_DEBUG("JSExportClass<", typeid(T).name(), ">::Finalize: destroy native object ", native_object_ptr, " for ", object_ref);
     if (native_object_ptr) {
-      //delete reinterpret_cast<T*>(native_object_ptr);
-      delete native_object_ptr;
+      JSExportAllocator<T>::Destroy(native_object_ptr);
       JSObjectSetPrivate(object_ref, nullptr);
     }
   }
   
   template<typename T>
-  JSValueRef JSExportClass<T>::GetNamedValuePropertyCallback(JSContextRef context_ref, JSObjectRef object_ref, JSStringRef property_name_ref, JSValueRef* exception) try {
+  JSValueRef JSExportClass<T>::GetNamedValuePropertyCallback(JSContextRef context_ref, JSObjectRef object_ref, JSStringRef property_name_ref, JSValueRef* exception) {
+    const auto index = js_export_class_definition__.FindNamedValueProperty(property_name_ref);
     
-    JSObject js_object(JSObject::FindJSObject(context_ref, object_ref));
+    // precondition
+    assert(index < js_export_class_definition__.named_value_properties__.size());
     
-    const std::string property_name = JSString(property_name_ref);
+    return GetNamedValueProperty(index, context_ref, object_ref, exception);
+  }
+  
+  template<typename T>
+  bool JSExportClass<T>::SetNamedValuePropertyCallback(JSContextRef context_ref, JSObjectRef object_ref, JSStringRef property_name_ref, JSValueRef value_ref, JSValueRef* exception) {
+    const auto index = js_export_class_definition__.FindNamedValueProperty(property_name_ref);
     
-    const auto callback_position = js_export_class_definition__.named_value_property_callback_map__.find(property_name);
-    const bool callback_found    = callback_position != js_export_class_definition__.named_value_property_callback_map__.end();
+    // precondition
+    assert(index < js_export_class_definition__.named_value_properties__.size());
     
-    HAL_LOG_DEBUG("JSExportClass<", typeid(T).name(), ">::GetNamedProperty: callback found = ", callback_found, " for ", to_string(js_object), ".", property_name);
+    return SetNamedValueProperty(index, context_ref, object_ref, value_ref, exception);
+  }
+  
+  template<typename T>
+  JSValueRef JSExportClass<T>::GetNamedValueProperty(std::size_t index, JSContextRef context_ref, JSObjectRef object_ref, JSValueRef* exception) try {
     
-    // precondition
-    assert(callback_found);
+    const auto& property_name = js_export_class_definition__.named_value_properties__[index].name;
+    
+    HAL_LOG_DEBUG("JSExportClass<", typeid(T).name(), ">::GetNamedProperty: index = ", index, " for ", to_string(JSObject(context_ref, object_ref, JSObject::BorrowedTag())), ".", property_name);
     
     try {
-      const auto native_object_ptr = static_cast<const T*>(js_object.GetPrivate());
-      const auto callback          = (callback_position -> second).get_callback();
-      const auto result            = callback(*native_object_ptr);
+      const auto  native_object_ptr = static_cast<const T*>(JSObjectGetPrivate(object_ref));
+      const auto& callback          = js_export_class_definition__.named_value_properties__[index].callback.get_callback();
+      const auto  result            = callback(*native_object_ptr);
       
-      HAL_LOG_DEBUG("JSExportClass<", typeid(T).name(), ">::GetNamedProperty: result = ", to_string(result), " for ", to_string(js_object), ".", property_name);
+      HAL_LOG_DEBUG("JSExportClass<", typeid(T).name(), ">::GetNamedProperty: result = ", to_string(result), " for ", to_string(JSObject(context_ref, object_ref, JSObject::BorrowedTag())), ".", property_name);
       
       return static_cast<JSValueRef>(result);
 
     } catch (const js_runtime_error& e) {
-      JSObject js_object(JSObject::FindJSObject(context_ref, object_ref));
+      JSObject js_object(context_ref, object_ref, JSObject::BorrowedTag());
       *exception = static_cast<JSValueRef>(CreateJSError("GetNamedProperty", property_name, js_object, e));
       return nullptr;
     }
 
   } catch (const std::exception& e) {
-    JSObject js_object(JSObject::FindJSObject(context_ref, object_ref));
+    JSObject js_object(context_ref, object_ref, JSObject::BorrowedTag());
     *exception = static_cast<JSValueRef>(CreateJSError("GetNamedProperty", js_object, e));
     return nullptr;
   } catch (...) {
-    JSObject js_object(JSObject::FindJSObject(context_ref, object_ref));
+    JSObject js_object(context_ref, object_ref, JSObject::BorrowedTag());
     *exception = static_cast<JSValueRef>(CreateJSError("GetNamedProperty", js_object, "unknown exception"));
     return nullptr;
   }
   
   template<typename T>
-  bool JSExportClass<T>::SetNamedValuePropertyCallback(JSContextRef context_ref, JSObjectRef object_ref, JSStringRef property_name_ref, JSValueRef value_ref, JSValueRef* exception) try {
-    
-    JSObject js_object(JSObject::FindJSObject(context_ref, object_ref));
-    JSValue  js_value(js_object.get_context(), value_ref);
+  bool JSExportClass<T>::SetNamedValueProperty(std::size_t index, JSContextRef context_ref, JSObjectRef object_ref, JSValueRef value_ref, JSValueRef* exception) try {
     
-    const std::string property_name = JSString(property_name_ref);
+    const auto& property_name = js_export_class_definition__.named_value_properties__[index].name;
+    JSValue     js_value(JSContext(context_ref), value_ref);
     
-    const auto callback_position = js_export_class_definition__.named_value_property_callback_map__.find(property_name);
-    const bool callback_found    = callback_position != js_export_class_definition__.named_value_property_callback_map__.end();
-    
-    HAL_LOG_DEBUG("JSExportClass<", typeid(T).name(), ">::SetNamedProperty: callback found = ", callback_found, " for ", to_string(js_object), ".", property_name);
-    
-    // precondition
-    assert(callback_found);
+    HAL_LOG_DEBUG("JSExportClass<", typeid(T).name(), ">::SetNamedProperty: index = ", index, " for ", to_string(JSObject(context_ref, object_ref, JSObject::BorrowedTag())), ".", property_name);
     
     try {
-      auto native_object_ptr = static_cast<T*>(js_object.GetPrivate());
-      const auto callback    = (callback_position -> second).set_callback();
-      const auto result      = callback(*native_object_ptr, js_value);
+      auto        native_object_ptr = static_cast<T*>(JSObjectGetPrivate(object_ref));
+      const auto& callback          = js_export_class_definition__.named_value_properties__[index].callback.set_callback();
+      const auto  result            = callback(*native_object_ptr, js_value);
       
-      HAL_LOG_DEBUG("JSExportClass<", typeid(T).name(), ">::SetNamedProperty: result = ", result, " for ", to_string(js_object), ".", property_name);
+      HAL_LOG_DEBUG("JSExportClass<", typeid(T).name(), ">::SetNamedProperty: result = ", result, " for ", to_string(JSObject(context_ref, object_ref, JSObject::BorrowedTag())), ".", property_name);
       
       return result;
 
     } catch (const js_runtime_error& e) {
-      JSObject js_object(JSObject::FindJSObject(context_ref, object_ref));
+      JSObject js_object(context_ref, object_ref, JSObject::BorrowedTag());
       *exception = static_cast<JSValueRef>(CreateJSError("SetNamedProperty", property_name, js_object, e));
       return false;
     }
     
   } catch (const std::exception& e) {
-    JSObject js_object(JSObject::FindJSObject(context_ref, object_ref));
+    JSObject js_object(context_ref, object_ref, JSObject::BorrowedTag());
     *exception = static_cast<JSValueRef>(CreateJSError("SetNamedProperty", js_object, e));
     return false;
   } catch (...) {
-    JSObject js_object(JSObject::FindJSObject(context_ref, object_ref));
+    JSObject js_object(context_ref, object_ref, JSObject::BorrowedTag());
     *exception = static_cast<JSValueRef>(CreateJSError("SetNamedProperty", js_object, "unknown exception"));
     return false;
   }
@@ -302,8 +407,9 @@ namespace HAL { namespace detail {
     // function's name for lookup.
     static std::regex regex("^function\\s+([^(]+)\\(\\)(.|\\n)*$");
     
-    JSObject          js_object(JSObject::FindJSObject(context_ref, function_ref));
-    JSObject          this_object(JSObject::FindJSObject(context_ref, this_object_ref));
+    JSContext         js_context(context_ref, JSContext::BorrowedTag());
+    JSObject          js_object(js_context, function_ref, JSObject::BorrowedTag());
+    JSObject          this_object(js_context, this_object_ref, JSObject::BorrowedTag());
     const std::string js_object_string = to_string(js_object);
     std::smatch       match_results;
     const bool        found = std::regex_match(js_object_string, match_results, regex);
@@ -334,8 +440,8 @@ namespace HAL { namespace detail {
     assert(callback_found);
 
     try {
-      const auto callback = (callback_position -> second).function_callback();
-      const auto result   = callback(*native_this_ptr, to_vector(this_object.get_context(), argument_count, arguments_array), this_object);
+      const auto& callback = (callback_position -> second).function_callback();
+      const auto  result   = callback(*native_this_ptr, to_vector(js_context, argument_count, arguments_array), this_object);
       
 #ifdef HAL_LOGGING_ENABLE
       std::string js_value_str;
@@ -354,23 +460,305 @@ namespace HAL { namespace detail {
       return static_cast<JSValueRef>(result);
 
     } catch (const js_runtime_error& e) {
-      JSObject js_object(JSObject::FindJSObject(context_ref, function_ref));
+      JSObject js_object(context_ref, function_ref, JSObject::BorrowedTag());
       *exception = static_cast<JSValueRef>(CreateJSError("CallNamedFunction", function_name, js_object, e));
       return nullptr;
     }
 
   } catch (const std::exception& e) {
-    JSObject js_object(JSObject::FindJSObject(context_ref, function_ref));
+    JSObject js_object(context_ref, function_ref, JSObject::BorrowedTag());
     *exception = static_cast<JSValueRef>(CreateJSError("CallNamedFunction", js_object, e));
     return nullptr;
   } catch (...) {
-    JSObject js_object(JSObject::FindJSObject(context_ref, function_ref));
+    JSObject js_object(context_ref, function_ref, JSObject::BorrowedTag());
     *exception = static_cast<JSValueRef>(CreateJSError("CallNamedFunction", js_object, "unknown exception"));
     return nullptr;
   }
 
   template<typename T>
-  JSValue JSExportClass<T>::CreateJSError(const std::string& function_name, const std::string& location, JSObject js_source, const js_runtime_error& e) {
+  template<JSValue (T::*Getter)() const>
+  JSValueRef JSExportClass<T>::GetMemberValueThunk(JSContextRef context_ref, JSObjectRef object_ref, JSStringRef property_name_ref, JSValueRef* exception) try {
+    
+    const auto native_object_ptr = static_cast<const T*>(JSObjectGetPrivate(object_ref));
+    if (!native_object_ptr) {
+      // Forward the request, e.g. for a prototype object.
+      return nullptr;
+    }
+    
+    try {
+      return static_cast<JSValueRef>((native_object_ptr ->* Getter)());
+    } catch (const js_runtime_error& e) {
+      JSObject js_object(context_ref, object_ref, JSObject::BorrowedTag());
+      *exception = static_cast<JSValueRef>(CreateJSError("GetNamedProperty", JSString(property_name_ref), js_object, e));
+      return nullptr;
+    }
+    
+  } catch (const std::exception& e) {
+    JSObject js_object(context_ref, object_ref, JSObject::BorrowedTag());
+    *exception = static_cast<JSValueRef>(CreateJSError("GetNamedProperty", js_object, e));
+    return nullptr;
+  } catch (...) {
+    JSObject js_object(context_ref, object_ref, JSObject::BorrowedTag());
+    *exception = static_cast<JSValueRef>(CreateJSError("GetNamedProperty", js_object, "unknown exception"));
+    return nullptr;
+  }
+  
+  template<typename T>
+  template<bool (T::*Setter)(const JSValue&)>
+  bool JSExportClass<T>::SetMemberValueThunk(JSContextRef context_ref, JSObjectRef object_ref, JSStringRef property_name_ref, JSValueRef value_ref, JSValueRef* exception) try {
+    
+    const auto native_object_ptr = static_cast<T*>(JSObjectGetPrivate(object_ref));
+    if (!native_object_ptr) {
+      // Forward the request, e.g. for a prototype object.
+      return false;
+    }
+    
+    try {
+      return (native_object_ptr ->* Setter)(JSValue(JSContext(context_ref), value_ref));
+    } catch (const js_runtime_error& e) {
+      JSObject js_object(context_ref, object_ref, JSObject::BorrowedTag());
+      *exception = static_cast<JSValueRef>(CreateJSError("SetNamedProperty", JSString(property_name_ref), js_object, e));
+      return false;
+    }
+    
+  } catch (const std::exception& e) {
+    JSObject js_object(context_ref, object_ref, JSObject::BorrowedTag());
+    *exception = static_cast<JSValueRef>(CreateJSError("SetNamedProperty", js_object, e));
+    return false;
+  } catch (...) {
+    JSObject js_object(context_ref, object_ref, JSObject::BorrowedTag());
+    *exception = static_cast<JSValueRef>(CreateJSError("SetNamedProperty", js_object, "unknown exception"));
+    return false;
+  }
+  
+  template<typename T>
+  template<JSValue (T::*Method)(const std::vector<JSValue>&, JSObject&)>
+  JSValueRef JSExportClass<T>::CallMemberFunctionThunk(JSContextRef context_ref, JSObjectRef function_ref, JSObjectRef this_object_ref, size_t argument_count, const JSValueRef arguments_array[], JSValueRef* exception) try {
+    
+    JSContext  js_context(context_ref, JSContext::BorrowedTag());
+    JSObject   this_object(js_context, this_object_ref, JSObject::BorrowedTag());
+    const auto native_this_ptr = static_cast<T*>(JSObjectGetPrivate(this_object_ref));
+    if (!native_this_ptr) {
+      JSObject js_object(js_context, function_ref, JSObject::BorrowedTag());
+      *exception = static_cast<JSValueRef>(CreateJSError("CallNamedFunction", js_object, "this object has no native object"));
+      return nullptr;
+    }
+    
+    try {
+      return static_cast<JSValueRef>((native_this_ptr ->* Method)(to_vector(js_context, argument_count, arguments_array), this_object));
+    } catch (const js_runtime_error& e) {
+      JSObject js_object(context_ref, function_ref, JSObject::BorrowedTag());
+      *exception = static_cast<JSValueRef>(CreateJSError("CallNamedFunction", "", js_object, e));
+      return nullptr;
+    }
+    
+  } catch (const std::exception& e) {
+    JSObject js_object(context_ref, function_ref, JSObject::BorrowedTag());
+    *exception = static_cast<JSValueRef>(CreateJSError("CallNamedFunction", js_object, e));
+    return nullptr;
+  } catch (...) {
+    JSObject js_object(context_ref, function_ref, JSObject::BorrowedTag());
+    *exception = static_cast<JSValueRef>(CreateJSError("CallNamedFunction", js_object, "unknown exception"));
+    return nullptr;
+  }
+  
+  template<typename T>
+  template<JSValue (T::*Method)(const JSArguments&, JSObject&)>
+  JSValueRef JSExportClass<T>::CallArgumentsFunctionThunk(JSContextRef context_ref, JSObjectRef function_ref, JSObjectRef this_object_ref, size_t argument_count, const JSValueRef arguments_array[], JSValueRef* exception) try {
+    
+    JSObject   this_object(context_ref, this_object_ref, JSObject::BorrowedTag());
+    const auto native_this_ptr = static_cast<T*>(JSObjectGetPrivate(this_object_ref));
+    if (!native_this_ptr) {
+      JSObject js_object(context_ref, function_ref, JSObject::BorrowedTag());
+      *exception = static_cast<JSValueRef>(CreateJSError("CallNamedFunction", js_object, "this object has no native object"));
+      return nullptr;
+    }
+    
+    try {
+      return static_cast<JSValueRef>((native_this_ptr ->* Method)(JSArguments(context_ref, argument_count, arguments_array), this_object));
+    } catch (const js_runtime_error& e) {
+      JSObject js_object(context_ref, function_ref, JSObject::BorrowedTag());
+      *exception = static_cast<JSValueRef>(CreateJSError("CallNamedFunction", "", js_object, e));
+      return nullptr;
+    }
+    
+  } catch (const std::exception& e) {
+    JSObject js_object(context_ref, function_ref, JSObject::BorrowedTag());
+    *exception = static_cast<JSValueRef>(CreateJSError("CallNamedFunction", js_object, e));
+    return nullptr;
+  } catch (...) {
+    JSObject js_object(context_ref, function_ref, JSObject::BorrowedTag());
+    *exception = static_cast<JSValueRef>(CreateJSError("CallNamedFunction", js_object, "unknown exception"));
+    return nullptr;
+  }
+  
+  template<typename T>
+  template<typename F, F Field>
+  JSValueRef JSExportClass<T>::GetDataMemberThunk(JSContextRef context_ref, JSObjectRef object_ref, JSStringRef, JSValueRef* exception) try {
+    
+    using traits = NativeDataMemberTraits<F>;
+    static_assert(std::is_base_of<typename traits::object_type, T>::value, "The data member must be a member of T or of a base class of T");
+    
+    const auto native_object_ptr = static_cast<const T*>(JSObjectGetPrivate(object_ref));
+    if (!native_object_ptr) {
+      // Forward the request, e.g. for a prototype object.
+      return nullptr;
+    }
+    
+    return ToJSValueRef(context_ref, static_cast<typename traits::value_type>(native_object_ptr ->* Field));
+    
+  } catch (const std::exception& e) {
+    JSObject js_object(context_ref, object_ref, JSObject::BorrowedTag());
+    *exception = static_cast<JSValueRef>(CreateJSError("GetNamedProperty", js_object, e));
+    return nullptr;
+  } catch (...) {
+    JSObject js_object(context_ref, object_ref, JSObject::BorrowedTag());
+    *exception = static_cast<JSValueRef>(CreateJSError("GetNamedProperty", js_object, "unknown exception"));
+    return nullptr;
+  }
+  
+  template<typename T>
+  template<typename F, F Field>
+  bool JSExportClass<T>::SetDataMemberThunk(JSContextRef context_ref, JSObjectRef object_ref, JSStringRef property_name_ref, JSValueRef value_ref, JSValueRef* exception) try {
+    
+    using traits = NativeDataMemberTraits<F>;
+    static_assert(std::is_base_of<typename traits::object_type, T>::value, "The data member must be a member of T or of a base class of T");
+    
+    const auto native_object_ptr = static_cast<T*>(JSObjectGetPrivate(object_ref));
+    if (!native_object_ptr) {
+      // Forward the request, e.g. for a prototype object.
+      return false;
+    }
+    
+    try {
+      const auto value = static_cast<typename traits::value_type>(JSValueView(context_ref, value_ref));
+      native_object_ptr ->* Field = static_cast<typename traits::member_type>(value);
+      return true;
+    } catch (const js_runtime_error& e) {
+      JSObject js_object(context_ref, object_ref, JSObject::BorrowedTag());
+      *exception = static_cast<JSValueRef>(CreateJSError("SetNamedProperty", JSString(property_name_ref), js_object, e));
+      return false;
+    }
+    
+  } catch (const std::exception& e) {
+    JSObject js_object(context_ref, object_ref, JSObject::BorrowedTag());
+    *exception = static_cast<JSValueRef>(CreateJSError("SetNamedProperty", js_object, e));
+    return false;
+  } catch (...) {
+    JSObject js_object(context_ref, object_ref, JSObject::BorrowedTag());
+    *exception = static_cast<JSValueRef>(CreateJSError("SetNamedProperty", js_object, "unknown exception"));
+    return false;
+  }
+  
+  template<typename T>
+  template<typename F, F Method>
+  JSValueRef JSExportClass<T>::CallNativeFunctionThunk(JSContextRef context_ref, JSObjectRef function_ref, JSObjectRef this_object_ref, size_t argument_count, const JSValueRef arguments_array[], JSValueRef* exception) try {
+    
+    using traits = NativeMemberFunctionTraits<F>;
+    static_assert(std::is_base_of<typename traits::object_type, T>::value, "The member function must be a member of T or of a base class of T");
+    const std::size_t arity = std::tuple_size<typename traits::argument_tuple>::value;
+    
+    const auto native_this_ptr = static_cast<T*>(JSObjectGetPrivate(this_object_ref));
+    if (!native_this_ptr) {
+      JSObject js_object(context_ref, function_ref, JSObject::BorrowedTag());
+      *exception = static_cast<JSValueRef>(CreateJSError("CallNamedFunction", js_object, "this object has no native object"));
+      return nullptr;
+    }
+    
+    if (argument_count < arity) {
+      JSObject js_object(context_ref, function_ref, JSObject::BorrowedTag());
+      *exception = static_cast<JSValueRef>(CreateJSError("CallNamedFunction", js_object, "Expected " + std::to_string(arity) + " arguments but got " + std::to_string(argument_count)));
+      return nullptr;
+    }
+    
+    try {
+      return CallNativeFunction<F, Method>(*native_this_ptr, context_ref, arguments_array, typename MakeIndexSequence<arity>::type());
+    } catch (const js_runtime_error& e) {
+      JSObject js_object(context_ref, function_ref, JSObject::BorrowedTag());
+      *exception = static_cast<JSValueRef>(CreateJSError("CallNamedFunction", "", js_object, e));
+      return nullptr;
+    }
+    
+  } catch (const std::exception& e) {
+    JSObject js_object(context_ref, function_ref, JSObject::BorrowedTag());
+    *exception = static_cast<JSValueRef>(CreateJSError("CallNamedFunction", js_object, e));
+    return nullptr;
+  } catch (...) {
+    JSObject js_object(context_ref, function_ref, JSObject::BorrowedTag());
+    *exception = static_cast<JSValueRef>(CreateJSError("CallNamedFunction", js_object, "unknown exception"));
+    return nullptr;
+  }
+  
+  template<typename T>
+  template<typename F, F Method, std::size_t... Indexes>
+  JSValueRef JSExportClass<T>::CallNativeFunction(T& native_object, JSContextRef context_ref, const JSValueRef arguments_array[], IndexSequence<Indexes...>) {
+    using traits = NativeMemberFunctionTraits<F>;
+    
+    // List-initialization converts the arguments from left to right,
+    // and stops at the first conversion that throws.
+    typename traits::argument_tuple arguments { static_cast<typename std::tuple_element<Indexes, typename traits::argument_tuple>::type>(JSValueView(context_ref, arguments_array[Indexes]))... };
+    static_cast<void>(arguments);
+    
+    return CallNativeFunction(context_ref, [&native_object, &arguments]() {
+        return (native_object .* Method)(std::forward<typename traits::template argument_type<Indexes>>(std::get<Indexes>(arguments))...);
+      }, std::is_void<typename traits::result_type>());
+  }
+  
+  template<typename T>
+  template<typename Callable>
+  JSValueRef JSExportClass<T>::CallNativeFunction(JSContextRef context_ref, Callable&& callable, std::true_type) {
+    callable();
+    return JSValueMakeUndefined(context_ref);
+  }
+  
+  template<typename T>
+  template<typename Callable>
+  JSValueRef JSExportClass<T>::CallNativeFunction(JSContextRef context_ref, Callable&& callable, std::false_type) {
+    return ToJSValueRef(context_ref, callable());
+  }
+  
+  template<typename T>
+  JSValueRef JSExportClass<T>::ToJSValueRef(JSContextRef context_ref, bool result) {
+    return JSValueMakeBoolean(context_ref, result);
+  }
+  
+  template<typename T>
+  JSValueRef JSExportClass<T>::ToJSValueRef(JSContextRef context_ref, double result) {
+    return JSValueMakeNumber(context_ref, result);
+  }
+  
+  template<typename T>
+  JSValueRef JSExportClass<T>::ToJSValueRef(JSContextRef context_ref, int32_t result) {
+    return JSValueMakeNumber(context_ref, result);
+  }
+  
+  template<typename T>
+  JSValueRef JSExportClass<T>::ToJSValueRef(JSContextRef context_ref, uint32_t result) {
+    return JSValueMakeNumber(context_ref, result);
+  }
+  
+  template<typename T>
+  JSValueRef JSExportClass<T>::ToJSValueRef(JSContextRef context_ref, const char* result) {
+    return ToJSValueRef(context_ref, JSString(result));
+  }
+  
+  template<typename T>
+  JSValueRef JSExportClass<T>::ToJSValueRef(JSContextRef context_ref, const std::string& result) {
+    return ToJSValueRef(context_ref, JSString(result));
+  }
+  
+  template<typename T>
+  JSValueRef JSExportClass<T>::ToJSValueRef(JSContextRef context_ref, const JSString& result) {
+    return JSValueMakeString(context_ref, static_cast<JSStringRef>(result));
+  }
+  
+  template<typename T>
+  JSValueRef JSExportClass<T>::ToJSValueRef(JSContextRef, const JSValue& result) {
+    return static_cast<JSValueRef>(result);
+  }
+  
+  template<typename T>
+  JSValue JSExportClass<T>::CreateJSError(const std::string& function_name, const std::string& location, const JSObject& js_source, const js_runtime_error& e) {
     const auto js_context = js_source.get_context();
     const auto name = GetJSExportComponentName(function_name, location);
 
@@ -389,12 +777,12 @@ namespace HAL { namespace detail {
   }
 
   template<typename T>
-  JSValue JSExportClass<T>::CreateJSError(const std::string& function_name, JSObject js_source, const std::exception& e) {
+  JSValue JSExportClass<T>::CreateJSError(const std::string& function_name, const JSObject& js_source, const std::exception& e) {
     return CreateJSError(function_name, js_source, e.what());
   }
 
   template<typename T>
-  JSValue JSExportClass<T>::CreateJSError(const std::string& function_name, JSObject js_source, const std::string& what) {
+  JSValue JSExportClass<T>::CreateJSError(const std::string& function_name, const JSObject& js_source, const std::string& what) {
     const auto js_context = js_source.get_context();
     const auto name = GetJSExportComponentName(function_name);
 
@@ -409,11 +797,22 @@ namespace HAL { namespace detail {
   template<typename T>
   bool JSExportClass<T>::JSObjectHasPropertyCallback(JSContextRef context_ref, JSObjectRef object_ref, JSStringRef property_name_ref) try {
     
-    JSObject js_object(JSObject::FindJSObject(context_ref, object_ref));
+    // Array indexes below the length are answered without creating a
+    // JSObject or a JSString.
+    unsigned index = 0;
+    const auto& length_callback = js_export_class_definition__.get_length_callback__;
+    if (length_callback && ToArrayIndex(property_name_ref, index)) {
+      const auto native_object_ptr = static_cast<const T*>(JSObjectGetPrivate(object_ref));
+      if (index < length_callback(*native_object_ptr)) {
+        return true;
+      }
+    }
+    
+    JSObject js_object(context_ref, object_ref, JSObject::BorrowedTag());
     JSString property_name(property_name_ref);
     
-    auto       callback       = js_export_class_definition__.has_property_callback__;
-    const bool callback_found = callback != nullptr;
+    const auto& callback       = js_export_class_definition__.has_property_callback__;
+    const bool  callback_found = callback != nullptr;
 
     const auto native_object_ptr = static_cast<const T*>(js_object.GetPrivate());
     HAL_LOG_DEBUG("JSExportClass<", typeid(T).name(), ">::HasProperty: callback found = ", callback_found, " for this[", native_object_ptr, "].", static_cast<std::string>(property_name));
@@ -438,18 +837,37 @@ namespace HAL { namespace detail {
   template<typename T>
   JSValueRef JSExportClass<T>::JSObjectGetPropertyCallback(JSContextRef context_ref, JSObjectRef object_ref, JSStringRef property_name_ref, JSValueRef* exception) try {
     
-    JSObject js_object(JSObject::FindJSObject(context_ref, object_ref));
-    JSString property_name(property_name_ref);
+    // Array indexes and 'length' are dispatched straight from the
+    // JSStringRef, without creating a JSObject or a JSString.
+    unsigned index = 0;
+    const auto& indexed_callback = js_export_class_definition__.get_indexed_property_callback__;
+    if (indexed_callback && ToArrayIndex(property_name_ref, index)) {
+      const auto native_object_ptr = static_cast<const T*>(JSObjectGetPrivate(object_ref));
+      const auto result            = indexed_callback(*native_object_ptr, index);
+      if (!result.IsNativeNull()) {
+        return static_cast<JSValueRef>(result);
+      }
+    }
+    
+    const auto& length_callback = js_export_class_definition__.get_length_callback__;
+    if (length_callback && JSStringIsEqualToUTF8CString(property_name_ref, "length")) {
+      const auto native_object_ptr = static_cast<const T*>(JSObjectGetPrivate(object_ref));
+      return JSValueMakeNumber(context_ref, length_callback(*native_object_ptr));
+    }
     
-    auto       callback       = js_export_class_definition__.get_property_callback__;
-    const bool callback_found = callback != nullptr;
+    const auto& callback       = js_export_class_definition__.get_property_callback__;
+    const bool  callback_found = callback != nullptr;
+    if (!callback_found) {
+      // Forward the request to the prototype chain.
+      return nullptr;
+    }
+    
+    JSObject js_object(context_ref, object_ref, JSObject::BorrowedTag());
+    JSString property_name(property_name_ref);
     
     const auto native_object_ptr = static_cast<const T*>(js_object.GetPrivate());
     HAL_LOG_DEBUG("JSExportClass<", typeid(T).name(), ">::GetProperty: callback found = ", callback_found, " for this[", native_object_ptr, "].", static_cast<std::string>(property_name));
     
-    // precondition
-    assert(callback_found);
-    
     try {
       const auto result = callback(*native_object_ptr, property_name);
       
@@ -468,17 +886,17 @@ namespace HAL { namespace detail {
       
       return static_cast<JSValueRef>(result);
     } catch (const js_runtime_error& e) {
-      JSObject js_object(JSObject::FindJSObject(context_ref, object_ref));
+      JSObject js_object(context_ref, object_ref, JSObject::BorrowedTag());
       *exception = static_cast<JSValueRef>(CreateJSError("GetProperty", property_name, js_object, e));
       return nullptr;
     }
 
   } catch (const std::exception& e) {
-    JSObject js_object(JSObject::FindJSObject(context_ref, object_ref));
+    JSObject js_object(context_ref, object_ref, JSObject::BorrowedTag());
     *exception = static_cast<JSValueRef>(CreateJSError("GetProperty", js_object, e));
     return nullptr;
   } catch (...) {
-    JSObject js_object(JSObject::FindJSObject(context_ref, object_ref));
+    JSObject js_object(context_ref, object_ref, JSObject::BorrowedTag());
     *exception = static_cast<JSValueRef>(CreateJSError("GetProperty", js_object, "unknown exception"));
     return nullptr;
   }
@@ -486,34 +904,46 @@ namespace HAL { namespace detail {
   template<typename T>
   bool JSExportClass<T>::JSObjectSetPropertyCallback(JSContextRef context_ref, JSObjectRef object_ref, JSStringRef property_name_ref, JSValueRef value_ref, JSValueRef* exception) try {
     
-    JSObject js_object(JSObject::FindJSObject(context_ref, object_ref));
-    JSString property_name(property_name_ref);
+    // Array indexes are dispatched straight from the JSStringRef,
+    // without creating a JSObject or a JSString.
+    unsigned index = 0;
+    const auto& indexed_callback = js_export_class_definition__.set_indexed_property_callback__;
+    if (indexed_callback && ToArrayIndex(property_name_ref, index)) {
+      const auto native_object_ptr = static_cast<T*>(JSObjectGetPrivate(object_ref));
+      if (indexed_callback(*native_object_ptr, index, JSValue(JSContext(context_ref), value_ref))) {
+        return true;
+      }
+    }
     
-    auto       callback       = js_export_class_definition__.set_property_callback__;
-    const bool callback_found = callback != nullptr;
+    const auto& callback       = js_export_class_definition__.set_property_callback__;
+    const bool  callback_found = callback != nullptr;
+    if (!callback_found) {
+      // Forward the request to the prototype chain.
+      return false;
+    }
+    
+    JSObject js_object(context_ref, object_ref, JSObject::BorrowedTag());
+    JSString property_name(property_name_ref);
     
     auto native_object_ptr = static_cast<T*>(js_object.GetPrivate());
     HAL_LOG_DEBUG("JSExportClass<", typeid(T).name(), ">::SetProperty: callback found = ", callback_found, " for this[", native_object_ptr, "].", static_cast<std::string>(property_name));
     
-    // precondition
-    assert(callback_found);
-    
     try {
       const auto result = callback(*native_object_ptr, property_name, JSValue(js_object.get_context(), value_ref));
       HAL_LOG_DEBUG("JSExportClass<", typeid(T).name(), ">::SetProperty: result = ", result, " for this[", native_object_ptr, "].", static_cast<std::string>(property_name));
       return result;
     } catch (const js_runtime_error& e) {
-      JSObject js_object(JSObject::FindJSObject(context_ref, object_ref));
+      JSObject js_object(context_ref, object_ref, JSObject::BorrowedTag());
       *exception = static_cast<JSValueRef>(CreateJSError("SetProperty", property_name, js_object, e));
       return false;
     }
 
   } catch (const std::exception& e) {
-    JSObject js_object(JSObject::FindJSObject(context_ref, object_ref));
+    JSObject js_object(context_ref, object_ref, JSObject::BorrowedTag());
     *exception = static_cast<JSValueRef>(CreateJSError("SetProperty", js_object, e));
     return false;
   } catch (...) {
-    JSObject js_object(JSObject::FindJSObject(context_ref, object_ref));
+    JSObject js_object(context_ref, object_ref, JSObject::BorrowedTag());
     *exception = static_cast<JSValueRef>(CreateJSError("SetProperty", js_object, "unknown exception"));
     return false;
   }
@@ -521,11 +951,11 @@ namespace HAL { namespace detail {
   template<typename T>
   bool JSExportClass<T>::JSObjectDeletePropertyCallback(JSContextRef context_ref, JSObjectRef object_ref, JSStringRef property_name_ref, JSValueRef* exception) try {
     
-    JSObject js_object(JSObject::FindJSObject(context_ref, object_ref));
+    JSObject js_object(context_ref, object_ref, JSObject::BorrowedTag());
     JSString property_name(property_name_ref);
     
-    auto       callback       = js_export_class_definition__.delete_property_callback__;
-    const bool callback_found = callback != nullptr;
+    const auto& callback       = js_export_class_definition__.delete_property_callback__;
+    const bool  callback_found = callback != nullptr;
     
     auto native_object_ptr = static_cast<T*>(js_object.GetPrivate());
     HAL_LOG_DEBUG("JSExportClass<", typeid(T).name(), ">::DeleteProperty: callback found = ", callback_found, " for this[", native_object_ptr, "].", static_cast<std::string>(property_name));
@@ -538,17 +968,17 @@ namespace HAL { namespace detail {
       HAL_LOG_DEBUG("JSExportClass<", typeid(T).name(), ">::DeleteProperty: result = ", result, " for this[", native_object_ptr, "].", static_cast<std::string>(property_name));
       return result;
     } catch (const js_runtime_error& e) {
-      JSObject js_object(JSObject::FindJSObject(context_ref, object_ref));
+      JSObject js_object(context_ref, object_ref, JSObject::BorrowedTag());
       *exception = static_cast<JSValueRef>(CreateJSError("DeleteProperty", property_name, js_object, e));
       return false;
     }
     
   } catch (const std::exception& e) {
-    JSObject js_object(JSObject::FindJSObject(context_ref, object_ref));
+    JSObject js_object(context_ref, object_ref, JSObject::BorrowedTag());
     *exception = static_cast<JSValueRef>(CreateJSError("DeleteProperty", js_object, e));
     return false;
   } catch (...) {
-    JSObject js_object(JSObject::FindJSObject(context_ref, object_ref));
+    JSObject js_object(context_ref, object_ref, JSObject::BorrowedTag());
     *exception = static_cast<JSValueRef>(CreateJSError("DeleteProperty", js_object, "unknown exception"));
     return false;
   }
@@ -556,19 +986,26 @@ namespace HAL { namespace detail {
   template<typename T>
   void JSExportClass<T>::JSObjectGetPropertyNamesCallback(JSContextRef context_ref, JSObjectRef object_ref, JSPropertyNameAccumulatorRef property_names) try {
     
-    JSObject                  js_object(JSObject::FindJSObject(context_ref, object_ref));
+    JSObject                  js_object(context_ref, object_ref, JSObject::BorrowedTag());
     JSPropertyNameAccumulator js_property_name_accumulator(property_names);
     
-    auto       callback       = js_export_class_definition__.get_property_names_callback__;
-    const bool callback_found = callback != nullptr;
+    const auto& callback       = js_export_class_definition__.get_property_names_callback__;
+    const bool  callback_found = callback != nullptr;
     
     auto native_object_ptr = static_cast<T*>(js_object.GetPrivate());
     HAL_LOG_DEBUG("JSExportClass<", typeid(T).name(), ">::GetPropertyNames: callback found = ", callback_found, " for this[", native_object_ptr, "]");
     
-    // precondition
-    assert(callback_found);
+    const auto& length_callback = js_export_class_definition__.get_length_callback__;
+    if (length_callback) {
+      const unsigned length = length_callback(*native_object_ptr);
+      for (unsigned index = 0; index < length; ++index) {
+        js_property_name_accumulator.AddName(JSString(std::to_string(index)));
+      }
+    }
     
-    callback(*native_object_ptr, js_property_name_accumulator);
+    if (callback_found) {
+      callback(*native_object_ptr, js_property_name_accumulator);
+    }
 
   } catch (const std::exception& e) {
     HAL_LOG_ERROR(GetJSExportComponentName("GetPropertyNames"), ": ", e.what());
@@ -579,14 +1016,15 @@ namespace HAL { namespace detail {
   template<typename T>
   JSValueRef JSExportClass<T>::JSObjectCallAsFunctionCallback(JSContextRef context_ref, JSObjectRef function_ref, JSObjectRef this_object_ref, size_t argument_count, const JSValueRef arguments_array[], JSValueRef* exception) try {
     
-    JSObject js_object(JSObject::FindJSObject(context_ref, function_ref));
-    JSObject this_object(JSObject::FindJSObject(context_ref, this_object_ref));
+    JSContext js_context(context_ref, JSContext::BorrowedTag());
+    JSObject  js_object(js_context, function_ref, JSObject::BorrowedTag());
+    JSObject  this_object(js_context, this_object_ref, JSObject::BorrowedTag());
     
     // precondition
     assert(js_object.IsFunction());
     
-    auto       callback       = js_export_class_definition__.call_as_function_callback__;
-    const bool callback_found = callback != nullptr;
+    const auto& callback       = js_export_class_definition__.call_as_function_callback__;
+    const bool  callback_found = callback != nullptr;
     
     auto native_object_ptr = static_cast<T*>(js_object.GetPrivate());
     auto native_this_ptr   = static_cast<T*>(this_object.GetPrivate());
@@ -596,20 +1034,48 @@ namespace HAL { namespace detail {
     // precondition
     assert(callback_found);
     
-    const auto result = callback(*native_object_ptr, to_vector(this_object.get_context(), argument_count, arguments_array), this_object);
+    const auto result = callback(*native_object_ptr, to_vector(js_context, argument_count, arguments_array), this_object);
     HAL_LOG_DEBUG("JSExportClass<", typeid(T).name(), ">::CallAsFunction: result = ", to_string(result), " for this[", native_this_ptr, "].this[", native_object_ptr, "](...)");
     return static_cast<JSValueRef>(result);
 
   } catch (const js_runtime_error& e) {
-    JSObject js_object(JSObject::FindJSObject(context_ref, function_ref));
+    JSObject js_object(context_ref, function_ref, JSObject::BorrowedTag());
+    *exception = static_cast<JSValueRef>(CreateJSError("CallAsFunction", "", js_object, e));
+    return nullptr;
+  } catch (const std::exception& e) {
+    JSObject js_object(context_ref, function_ref, JSObject::BorrowedTag());
+    *exception = static_cast<JSValueRef>(CreateJSError("CallAsFunction", js_object, e));
+    return nullptr;
+  } catch (...) {
+    JSObject js_object(context_ref, function_ref, JSObject::BorrowedTag());
+    *exception = static_cast<JSValueRef>(CreateJSError("CallAsFunction", js_object, "unknown exception"));
+    return nullptr;
+  }
+  
+  template<typename T>
+  template<JSValue (T::*Method)(const JSArguments&, JSObject&)>
+  JSValueRef JSExportClass<T>::CallAsFunctionArgumentsThunk(JSContextRef context_ref, JSObjectRef function_ref, JSObjectRef this_object_ref, size_t argument_count, const JSValueRef arguments_array[], JSValueRef* exception) try {
+    
+    JSObject   this_object(context_ref, this_object_ref, JSObject::BorrowedTag());
+    const auto native_object_ptr = static_cast<T*>(JSObjectGetPrivate(function_ref));
+    
+    // precondition
+    assert(native_object_ptr);
+    
+    const auto result = (native_object_ptr ->* Method)(JSArguments(context_ref, argument_count, arguments_array), this_object);
+    HAL_LOG_DEBUG("JSExportClass<", typeid(T).name(), ">::CallAsFunction: result = ", to_string(result), " for this[", native_object_ptr, "](...)");
+    return static_cast<JSValueRef>(result);
+    
+  } catch (const js_runtime_error& e) {
+    JSObject js_object(context_ref, function_ref, JSObject::BorrowedTag());
     *exception = static_cast<JSValueRef>(CreateJSError("CallAsFunction", "", js_object, e));
     return nullptr;
   } catch (const std::exception& e) {
-    JSObject js_object(JSObject::FindJSObject(context_ref, function_ref));
+    JSObject js_object(context_ref, function_ref, JSObject::BorrowedTag());
     *exception = static_cast<JSValueRef>(CreateJSError("CallAsFunction", js_object, e));
     return nullptr;
   } catch (...) {
-    JSObject js_object(JSObject::FindJSObject(context_ref, function_ref));
+    JSObject js_object(context_ref, function_ref, JSObject::BorrowedTag());
     *exception = static_cast<JSValueRef>(CreateJSError("CallAsFunction", js_object, "unknown exception"));
     return nullptr;
   }
@@ -624,27 +1090,31 @@ namespace HAL { namespace detail {
     const auto native_object_ptr = static_cast<T*>(new_object.GetPrivate());
     HAL_LOG_DEBUG("JSExportClass<", typeid(T).name(), ">::CallAsConstructor: for this[", native_object_ptr, "]");
 
-    native_object_ptr->postCallAsConstructor(js_context, to_vector(js_context, argument_count, arguments_array));
+    // The JSArguments overload's default implementation calls the
+    // std::vector<JSValue> overload. A class that overrides only the
+    // latter and hides the former still gets it, through the
+    // conversion of JSArguments to std::vector<JSValue>.
+    native_object_ptr -> postCallAsConstructor(js_context, JSArguments(context_ref, argument_count, arguments_array));
 
     return static_cast<JSObjectRef>(new_object);
     
   } catch (const js_runtime_error& e) {
-    JSObject js_object(JSObject::FindJSObject(context_ref, constructor_ref));
+    JSObject js_object(context_ref, constructor_ref, JSObject::BorrowedTag());
     *exception = static_cast<JSValueRef>(CreateJSError("JSObjectCallAsConstructorCallback", "", js_object, e));
     return nullptr;
   } catch (const std::exception& e) {
-    JSObject js_object(JSObject::FindJSObject(context_ref, constructor_ref));
+    JSObject js_object(context_ref, constructor_ref, JSObject::BorrowedTag());
     *exception = static_cast<JSValueRef>(CreateJSError("JSObjectCallAsConstructorCallback", js_object, e));
     return nullptr;
   } catch (...) {
-    JSObject js_object(JSObject::FindJSObject(context_ref, constructor_ref));
+    JSObject js_object(context_ref, constructor_ref, JSObject::BorrowedTag());
     *exception = static_cast<JSValueRef>(CreateJSError("JSObjectCallAsConstructorCallback", js_object, "unknown exception"));
     return nullptr;
   }
   
   template<typename T>
   bool JSExportClass<T>::JSObjectHasInstanceCallback(JSContextRef context_ref, JSObjectRef constructor_ref, JSValueRef possible_instance_ref, JSValueRef* exception) try {
-    JSObject js_object(JSObject::FindJSObject(context_ref, constructor_ref));
+    JSObject js_object(context_ref, constructor_ref, JSObject::BorrowedTag());
     JSValue  possible_instance(js_object.get_context(), possible_instance_ref);
 
     bool result = false;
@@ -665,26 +1135,26 @@ namespace HAL { namespace detail {
     return result;
     
   } catch (const js_runtime_error& e) {
-    JSObject js_object(JSObject::FindJSObject(context_ref, constructor_ref));
+    JSObject js_object(context_ref, constructor_ref, JSObject::BorrowedTag());
     *exception = static_cast<JSValueRef>(CreateJSError("JSObjectHasInstanceCallback", "", js_object, e));
     return false;
   } catch (const std::exception& e) {
-    JSObject js_object(JSObject::FindJSObject(context_ref, constructor_ref));
+    JSObject js_object(context_ref, constructor_ref, JSObject::BorrowedTag());
     *exception = static_cast<JSValueRef>(CreateJSError("JSObjectHasInstanceCallback", js_object, e));
     return false;
   } catch (...) {
-    JSObject js_object(JSObject::FindJSObject(context_ref, constructor_ref));
+    JSObject js_object(context_ref, constructor_ref, JSObject::BorrowedTag());
     *exception = static_cast<JSValueRef>(CreateJSError("JSObjectHasInstanceCallback", js_object, "unknown exception"));
     return false;
   }
   
   template<typename T>
   JSValueRef JSExportClass<T>::JSObjectConvertToTypeCallback(JSContextRef context_ref, JSObjectRef object_ref, JSType type, JSValueRef* exception) try {
-    JSObject js_object(JSObject::FindJSObject(context_ref, object_ref));
+    JSObject js_object(context_ref, object_ref, JSObject::BorrowedTag());
     JSValue::Type js_value_type = ToJSValueType(type);
     
-    auto       callback       = js_export_class_definition__.convert_to_type_callback__;
-    const bool callback_found = callback != nullptr;
+    const auto& callback       = js_export_class_definition__.convert_to_type_callback__;
+    const bool  callback_found = callback != nullptr;
     
     const auto native_object_ptr = static_cast<const T*>(js_object.GetPrivate());
     HAL_LOG_DEBUG("JSExportClass<", typeid(T).name(), ">::ConvertToType: callback found = ", callback_found, " for this[", native_object_ptr, "]");
@@ -699,15 +1169,15 @@ namespace HAL { namespace detail {
     return static_cast<JSValueRef>(result);
     
   } catch (const js_runtime_error& e) {
-    JSObject js_object(JSObject::FindJSObject(context_ref, object_ref));
+    JSObject js_object(context_ref, object_ref, JSObject::BorrowedTag());
     *exception = static_cast<JSValueRef>(CreateJSError("JSObjectConvertToTypeCallback", "", js_object, e));
     return nullptr;
   } catch (const std::exception& e) {
-    JSObject js_object(JSObject::FindJSObject(context_ref, object_ref));
+    JSObject js_object(context_ref, object_ref, JSObject::BorrowedTag());
     *exception = static_cast<JSValueRef>(CreateJSError("JSObjectConvertToTypeCallback", js_object, e));
     return nullptr;
   } catch (...) {
-    JSObject js_object(JSObject::FindJSObject(context_ref, object_ref));
+    JSObject js_object(context_ref, object_ref, JSObject::BorrowedTag());
     *exception = static_cast<JSValueRef>(CreateJSError("JSObjectConvertToTypeCallback", js_object, "unknown exception"));
     return nullptr;
   }
@@ -19,6 +19,9 @@
 
 #include <string>
 #include <unordered_map>
+#include <vector>
+#include <cstddef>
+#include <cassert>
 
 namespace HAL { namespace detail {
   
@@ -33,6 +36,21 @@ namespace HAL { namespace detail {
   
   template<typename T>
   class JSExportClass;
+  
+  /*!
+   @struct
+   
+   @discussion A JSExportNamedValueProperty is a named value property
+   frozen by JSExportClassDefinition. The UTF-16 name lets
+   JSExportClass compare a JSStringRef property name in place,
+   without converting it to a std::string.
+   */
+  template<typename T>
+  struct JSExportNamedValueProperty final {
+    std::string                           name;
+    std::u16string                        u16name;
+    JSExportNamedValuePropertyCallback<T> callback;
+  };
 
   /*!
    @class
@@ -50,6 +68,11 @@ namespace HAL { namespace detail {
   class JSExportClassDefinition final : public JSClassDefinition HAL_PERFORMANCE_COUNTER2(JSExportClassDefinition<T>) {
   public:
     
+    // The number of value properties that JavaScriptCore calls
+    // through a dedicated thunk, which finds the property's callback
+    // by index instead of by name.
+    static const std::size_t kNamedValuePropertyThunkCount = 64;
+    
     JSExportClassDefinition(const JSExportClassDefinitionBuilder<T>& builder);
     JSExportClassDefinition()                                          = default;
     ~JSExportClassDefinition()                                         = default;
@@ -59,6 +82,23 @@ namespace HAL { namespace detail {
     JSExportClassDefinition& operator=(JSExportClassDefinition&&)      HAL_NOEXCEPT;
     void swap(JSExportClassDefinition&)                                HAL_NOEXCEPT;
     
+    // Return the number of value properties.
+    std::size_t get_named_value_property_count() const HAL_NOEXCEPT {
+      return named_value_properties__.size();
+    }
+    
+    // Return the index of the value property named property_name_ref
+    // in UTF-16 name order, or get_named_value_property_count() if
+    // there is none. The name is compared as UTF-16 in place.
+    std::size_t FindNamedValueProperty(JSStringRef property_name_ref) const HAL_NOEXCEPT;
+    
+    // Return the getter that JavaScriptCore calls for the value
+    // property at index in UTF-16 name order.
+    ::JSObjectGetPropertyCallback get_named_value_property_getter(std::size_t index) const HAL_NOEXCEPT {
+      assert(index < named_value_properties__.size());
+      return static_values__[index].getProperty;
+    }
+    
   private:
     
     void InitializeNamedPropertyCallbacks() HAL_NOEXCEPT;
@@ -67,7 +107,8 @@ namespace HAL { namespace detail {
     template<typename U>
     friend class JSExportClass;
     
-    JSExportNamedValuePropertyCallbackMap_t<T>    named_value_property_callback_map__;
+    // The value properties sorted by UTF-16 name.
+    std::vector<JSExportNamedValueProperty<T>>    named_value_properties__;
     JSExportNamedFunctionPropertyCallbackMap_t<T> named_function_property_callback_map__;
     HasPropertyCallback<T>                        has_property_callback__        { nullptr };
     GetPropertyCallback<T>                        get_property_callback__        { nullptr };
@@ -76,12 +117,15 @@ namespace HAL { namespace detail {
     GetPropertyNamesCallback<T>                   get_property_names_callback__  { nullptr };
     CallAsFunctionCallback<T>                     call_as_function_callback__    { nullptr };
     ConvertToTypeCallback<T>                      convert_to_type_callback__     { nullptr };
+    GetIndexedPropertyCallback<T>                 get_indexed_property_callback__ { nullptr };
+    SetIndexedPropertyCallback<T>                 set_indexed_property_callback__ { nullptr };
+    GetLengthCallback<T>                          get_length_callback__           { nullptr };
   };
   
   template<typename T>
   JSExportClassDefinition<T>::JSExportClassDefinition(const JSExportClassDefinition<T>& rhs) HAL_NOEXCEPT
   : JSClassDefinition(rhs)
-  , named_value_property_callback_map__(rhs.named_value_property_callback_map__)
+  , named_value_properties__(rhs.named_value_properties__)
   , named_function_property_callback_map__(rhs.named_function_property_callback_map__)
   , has_property_callback__(rhs.has_property_callback__)
   , get_property_callback__(rhs.get_property_callback__)
@@ -89,7 +133,10 @@ namespace HAL { namespace detail {
   , delete_property_callback__(rhs.delete_property_callback__)
   , get_property_names_callback__(rhs.get_property_names_callback__)
   , call_as_function_callback__(rhs.call_as_function_callback__)
-  , convert_to_type_callback__(rhs.convert_to_type_callback__) {
+  , convert_to_type_callback__(rhs.convert_to_type_callback__)
+  , get_indexed_property_callback__(rhs.get_indexed_property_callback__)
+  , set_indexed_property_callback__(rhs.set_indexed_property_callback__)
+  , get_length_callback__(rhs.get_length_callback__) {
     InitializeNamedPropertyCallbacks();
     
 //    std::clog << "MDL: copy ctor" << std::endl;
@@ -99,7 +146,7 @@ namespace HAL { namespace detail {
   template<typename T>
   JSExportClassDefinition<T>::JSExportClassDefinition(JSExportClassDefinition<T>&& rhs) HAL_NOEXCEPT
   : JSClassDefinition(rhs)
-  , named_value_property_callback_map__(std::move(rhs.named_value_property_callback_map__))
+  , named_value_properties__(std::move(rhs.named_value_properties__))
   , named_function_property_callback_map__(std::move(rhs.named_function_property_callback_map__))
   , has_property_callback__(std::move(rhs.has_property_callback__))
   , get_property_callback__(std::move(rhs.get_property_callback__))
@@ -107,7 +154,10 @@ namespace HAL { namespace detail {
   , delete_property_callback__(std::move(rhs.delete_property_callback__))
   , get_property_names_callback__(std::move(rhs.get_property_names_callback__))
   , call_as_function_callback__(std::move(rhs.call_as_function_callback__))
-  , convert_to_type_callback__(std::move(rhs.convert_to_type_callback__)) {
+  , convert_to_type_callback__(std::move(rhs.convert_to_type_callback__))
+  , get_indexed_property_callback__(std::move(rhs.get_indexed_property_callback__))
+  , set_indexed_property_callback__(std::move(rhs.set_indexed_property_callback__))
+  , get_length_callback__(std::move(rhs.get_length_callback__)) {
     InitializeNamedPropertyCallbacks();
     
 //    std::clog << "MDL: move ctor" << std::endl;
@@ -118,7 +168,7 @@ namespace HAL { namespace detail {
   JSExportClassDefinition<T>& JSExportClassDefinition<T>::operator=(const JSExportClassDefinition<T>& rhs) HAL_NOEXCEPT {
     HAL_JSCLASSDEFINITION_LOCK_GUARD;
     JSClassDefinition::operator=(rhs);
-    named_value_property_callback_map__    = rhs.named_value_property_callback_map__;
+    named_value_properties__               = rhs.named_value_properties__;
     named_function_property_callback_map__ = rhs.named_function_property_callback_map__;
     has_property_callback__                = rhs.has_property_callback__;
     get_property_callback__                = rhs.get_property_callback__;
@@ -127,6 +177,9 @@ namespace HAL { namespace detail {
     get_property_names_callback__          = rhs.get_property_names_callback__;
     call_as_function_callback__            = rhs.call_as_function_callback__;
     convert_to_type_callback__             = rhs.convert_to_type_callback__;
+    get_indexed_property_callback__        = rhs.get_indexed_property_callback__;
+    set_indexed_property_callback__        = rhs.set_indexed_property_callback__;
+    get_length_callback__                  = rhs.get_length_callback__;
     InitializeNamedPropertyCallbacks();
     
 //    std::clog << "MDL: copy assignment" << std::endl;
@@ -155,7 +208,7 @@ namespace HAL { namespace detail {
       
       // By swapping the members of two classes, the two classes are
       // effectively swapped.
-      swap(named_value_property_callback_map__   , other.named_value_property_callback_map__);
+      swap(named_value_properties__              , other.named_value_properties__);
       swap(named_function_property_callback_map__, other.named_function_property_callback_map__);
       swap(has_property_callback__               , other.has_property_callback__);
       swap(get_property_callback__               , other.get_property_callback__);
@@ -164,6 +217,9 @@ namespace HAL { namespace detail {
       swap(get_property_names_callback__         , other.get_property_names_callback__);
       swap(call_as_function_callback__           , other.call_as_function_callback__);
       swap(convert_to_type_callback__            , other.convert_to_type_callback__);
+      swap(get_indexed_property_callback__       , other.get_indexed_property_callback__);
+      swap(set_indexed_property_callback__       , other.set_indexed_property_callback__);
+      swap(get_length_callback__                 , other.get_length_callback__);
     }
     
     template<typename T>
@@ -177,14 +233,27 @@ namespace HAL { namespace detail {
       // Initialize staticValues.
       static_values__.clear();
       js_class_definition__.staticValues = nullptr;
-      if (!named_value_property_callback_map__.empty()) {
-        for (const auto& entry : named_value_property_callback_map__) {
-          const auto& property_name       = entry.first;
-          const auto& property_attributes = entry.second.get_attributes();
+      if (!named_value_properties__.empty()) {
+        const auto get_thunks = JSExportClass<T>::GetNamedValuePropertyThunks(typename MakeIndexSequence<kNamedValuePropertyThunkCount>::type());
+        const auto set_thunks = JSExportClass<T>::SetNamedValuePropertyThunks(typename MakeIndexSequence<kNamedValuePropertyThunkCount>::type());
+        for (std::size_t index = 0; index < named_value_properties__.size(); ++index) {
+          const auto& entry               = named_value_properties__[index];
+          const auto& property_attributes = entry.callback.get_attributes();
           ::JSStaticValue static_value;
-          static_value.name        = property_name.c_str();
-          static_value.getProperty = JSExportClass<T>::GetNamedValuePropertyCallback;
-          static_value.setProperty = JSExportClass<T>::SetNamedValuePropertyCallback;
+          static_value.name        = entry.name.c_str();
+          if (entry.callback.has_js_callbacks()) {
+            // Compile-time thunks are called directly by
+            // JavaScriptCore.
+            static_value.getProperty = entry.callback.get_js_get_callback();
+            static_value.setProperty = entry.callback.get_js_set_callback();
+          } else if (index < kNamedValuePropertyThunkCount) {
+            // The thunk for this index never examines the name.
+            static_value.getProperty = get_thunks[index];
+            static_value.setProperty = set_thunks[index];
+          } else {
+            static_value.getProperty = JSExportClass<T>::GetNamedValuePropertyCallback;
+            static_value.setProperty = JSExportClass<T>::SetNamedValuePropertyCallback;
+          }
           static_value.attributes  = ToJSPropertyAttributes(property_attributes);
           static_values__.push_back(static_value);
           // HAL_LOG_DEBUG("JSExportClassDefinition<", name__, "> added value property ", static_values__.back().name);
@@ -202,7 +271,8 @@ namespace HAL { namespace detail {
           const auto& property_attributes = entry.second.get_attributes();
           ::JSStaticFunction static_function;
           static_function.name           = function_name.c_str();
-          static_function.callAsFunction = JSExportClass<T>::CallNamedFunctionCallback;
+          const auto js_function_callback = entry.second.get_js_function_callback();
+          static_function.callAsFunction = js_function_callback ? js_function_callback : JSExportClass<T>::CallNamedFunctionCallback;
           static_function.attributes     = ToJSPropertyAttributes(property_attributes);
           static_functions__.push_back(static_function);
           // HAL_LOG_DEBUG("JSExportClassDefinition<", name__, "> added function property ", static_functions__.back().name);
@@ -212,6 +282,37 @@ namespace HAL { namespace detail {
       }
     }
     
+    template<typename T>
+    std::size_t JSExportClassDefinition<T>::FindNamedValueProperty(JSStringRef property_name_ref) const HAL_NOEXCEPT {
+      const JSChar*     characters = JSStringGetCharactersPtr(property_name_ref);
+      const std::size_t length     = JSStringGetLength(property_name_ref);
+      
+      // Binary search on the UTF-16 code units.
+      std::size_t first = 0;
+      std::size_t last  = named_value_properties__.size();
+      while (first < last) {
+        const std::size_t middle   = first + (last - first) / 2;
+        const auto&       u16name  = named_value_properties__[middle].u16name;
+        int               compared = 0;
+        for (std::size_t i = 0; compared == 0 && i < u16name.size() && i < length; ++i) {
+          compared = static_cast<int>(u16name[i]) - static_cast<int>(characters[i]);
+        }
+        if (compared == 0) {
+          compared = (u16name.size() < length) ? -1 : (u16name.size() > length ? 1 : 0);
+        }
+        if (compared == 0) {
+          return middle;
+        }
+        if (compared < 0) {
+          first = middle + 1;
+        } else {
+          last = middle;
+        }
+      }
+      
+      return named_value_properties__.size();
+    }
+    
     }} // namespace HAL { namespace detail {
     
 #endif // _HAL_DETAIL_JSEXPORTCLASSDEFINITION_HPP_
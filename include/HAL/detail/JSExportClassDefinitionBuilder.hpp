@@ -16,6 +16,7 @@
 
 #include <string>
 #include <cstdint>
+#include <algorithm>
 
 #undef HAL_DETAIL_JSEXPORTCLASSDEFINITIONBUILDER_MUTEX
 #undef HAL_DETAIL_JSEXPORTCLASSDEFINITIONBUILDER_LOCK_GUARD
@@ -251,9 +252,9 @@ namespace HAL { namespace detail {
      @result A reference to the builder for chaining.
      */
     JSExportClassDefinitionBuilder<T>& AddValueProperty(const JSString& property_name, GetNamedValuePropertyCallback<T> get_callback, SetNamedValuePropertyCallback<T> set_callback = nullptr, bool enumerable = true) {
-      std::unordered_set<JSPropertyAttribute> attributes { JSPropertyAttribute::DontDelete };
-      static_cast<void>(!enumerable   && attributes.insert(JSPropertyAttribute::DontEnum).second);
-      static_cast<void>(!set_callback && attributes.insert(JSPropertyAttribute::ReadOnly).second);
+      JSPropertyAttributeSet attributes { JSPropertyAttribute::DontDelete };
+      static_cast<void>(!enumerable   && attributes.insert(JSPropertyAttribute::DontEnum));
+      static_cast<void>(!set_callback && attributes.insert(JSPropertyAttribute::ReadOnly));
       HAL_DETAIL_JSEXPORTCLASSDEFINITIONBUILDER_LOCK_GUARD;
       AddValuePropertyCallback(JSExportNamedValuePropertyCallback<T>(property_name, get_callback, set_callback, attributes));
       return *this;
@@ -292,13 +293,186 @@ namespace HAL { namespace detail {
      @result A reference to the builder for chaining.
      */
     JSExportClassDefinitionBuilder<T>& AddFunctionProperty(const JSString& function_name, CallNamedFunctionCallback<T> function_callback, bool enumerable = true) {
-      std::unordered_set<JSPropertyAttribute> attributes { JSPropertyAttribute::DontDelete, JSPropertyAttribute::ReadOnly };
-      static_cast<void>(!enumerable && attributes.insert(JSPropertyAttribute::DontEnum).second);
+      JSPropertyAttributeSet attributes { JSPropertyAttribute::DontDelete, JSPropertyAttribute::ReadOnly };
+      static_cast<void>(!enumerable && attributes.insert(JSPropertyAttribute::DontEnum));
       HAL_DETAIL_JSEXPORTCLASSDEFINITIONBUILDER_LOCK_GUARD;
       AddFunctionPropertyCallback(JSExportNamedFunctionPropertyCallback<T>(function_name, function_callback, attributes));
       return *this;
     }
     
+    /*!
+     @method
+     
+     @abstract Add a value property whose getter and optional setter
+     are member functions of T known at compile time. The attributes
+     are the same as for the AddValueProperty method that takes
+     callbacks.
+     
+     @discussion JavaScriptCore calls a thunk instantiated for the
+     member functions directly, so getting or setting the property
+     does not look up its name or call a std::function. For example:
+     
+     builder.AddValueProperty<&Foo::GetName, &Foo::SetName>("name");
+     builder.AddValueProperty<&Foo::GetName>("name");
+     
+     The member functions must be declared in T itself, not in a base
+     class of T.
+     
+     @result A reference to the builder for chaining.
+     */
+    template<JSValue (T::*Getter)() const>
+    JSExportClassDefinitionBuilder<T>& AddValueProperty(const JSString& property_name, bool enumerable = true) {
+      JSPropertyAttributeSet attributes { JSPropertyAttribute::DontDelete, JSPropertyAttribute::ReadOnly };
+      static_cast<void>(!enumerable && attributes.insert(JSPropertyAttribute::DontEnum));
+      HAL_DETAIL_JSEXPORTCLASSDEFINITIONBUILDER_LOCK_GUARD;
+      AddValuePropertyCallback(JSExportNamedValuePropertyCallback<T>(property_name, &JSExportClass<T>::template GetMemberValueThunk<Getter>, nullptr, attributes));
+      return *this;
+    }
+    
+    template<JSValue (T::*Getter)() const, bool (T::*Setter)(const JSValue&)>
+    JSExportClassDefinitionBuilder<T>& AddValueProperty(const JSString& property_name, bool enumerable = true) {
+      JSPropertyAttributeSet attributes { JSPropertyAttribute::DontDelete };
+      static_cast<void>(!enumerable && attributes.insert(JSPropertyAttribute::DontEnum));
+      HAL_DETAIL_JSEXPORTCLASSDEFINITIONBUILDER_LOCK_GUARD;
+      AddValuePropertyCallback(JSExportNamedValuePropertyCallback<T>(property_name, &JSExportClass<T>::template GetMemberValueThunk<Getter>, &JSExportClass<T>::template SetMemberValueThunk<Setter>, attributes));
+      return *this;
+    }
+    
+    /*!
+     @method
+     
+     @abstract Add a value property that reads and writes a data
+     member of T, or of a base class of T, directly. The property will
+     always have the 'DontDelete' attribute, and will also have the
+     'ReadOnly' attribute if the data member is const. By default the
+     property is enumerable unless you specify otherwise.
+     
+     @discussion JavaScriptCore calls a getter and setter thunk
+     instantiated for the data member, so there is no property name
+     lookup, no std::function call and no hand-written accessor. The
+     data member may be bool, an arithmetic type of up to 32 bits,
+     float, double, std::string, JSString or JSValue. For example,
+     given this class definition:
+     
+     class Foo {
+     double ratio;
+     };
+     
+     You would call the builder like this:
+     
+     builder.AddValueProperty<decltype(&Foo::ratio), &Foo::ratio>("ratio");
+     
+     Setting the property converts the JavaScript value like the
+     corresponding JSValue conversion, e.g. with ToNumber for a
+     double.
+     
+     @result A reference to the builder for chaining.
+     */
+    template<typename F, F Field>
+    JSExportClassDefinitionBuilder<T>& AddValueProperty(const JSString& property_name, bool enumerable = true) {
+      using is_const = typename NativeDataMemberTraits<F>::is_const;
+      JSPropertyAttributeSet attributes { JSPropertyAttribute::DontDelete };
+      static_cast<void>(!enumerable     && attributes.insert(JSPropertyAttribute::DontEnum));
+      static_cast<void>(is_const::value && attributes.insert(JSPropertyAttribute::ReadOnly));
+      HAL_DETAIL_JSEXPORTCLASSDEFINITIONBUILDER_LOCK_GUARD;
+      AddValuePropertyCallback(JSExportNamedValuePropertyCallback<T>(property_name, &JSExportClass<T>::template GetDataMemberThunk<F, Field>, JSExportClass<T>::template GetDataMemberSetThunk<F, Field>(is_const()), attributes));
+      return *this;
+    }
+    
+    /*!
+     @method
+     
+     @abstract Add a function property whose implementation is a
+     member function of T known at compile time. The attributes are
+     the same as for the AddFunctionProperty method that takes a
+     callback.
+     
+     @discussion JavaScriptCore calls a thunk instantiated for the
+     member function directly, so calling the function does not
+     recover its name from the function object or call a
+     std::function. For example:
+     
+     builder.AddFunctionProperty<&Foo::Hello>("hello");
+     
+     The member function must be declared in T itself, not in a base
+     class of T.
+     
+     @result A reference to the builder for chaining.
+     */
+    template<JSValue (T::*Method)(const std::vector<JSValue>&, JSObject&)>
+    JSExportClassDefinitionBuilder<T>& AddFunctionProperty(const JSString& function_name, bool enumerable = true) {
+      JSPropertyAttributeSet attributes { JSPropertyAttribute::DontDelete, JSPropertyAttribute::ReadOnly };
+      static_cast<void>(!enumerable && attributes.insert(JSPropertyAttribute::DontEnum));
+      HAL_DETAIL_JSEXPORTCLASSDEFINITIONBUILDER_LOCK_GUARD;
+      AddFunctionPropertyCallback(JSExportNamedFunctionPropertyCallback<T>(function_name, &JSExportClass<T>::template CallMemberFunctionThunk<Method>, attributes));
+      return *this;
+    }
+    
+    /*!
+     @method
+     
+     @abstract Add a function property whose implementation is a
+     member function of T known at compile time that takes its
+     arguments as a JSArguments, like this:
+     
+     builder.AddFunctionProperty<&Foo::Sum>("sum");
+     
+     @discussion The JSArguments is a view of the argument array that
+     JavaScriptCore passes to the thunk, so calling the function
+     neither allocates a std::vector nor protects each argument. It is
+     only valid for the duration of the call.
+     
+     The member function must be declared in T itself, not in a base
+     class of T.
+     
+     @result A reference to the builder for chaining.
+     */
+    template<JSValue (T::*Method)(const JSArguments&, JSObject&)>
+    JSExportClassDefinitionBuilder<T>& AddFunctionProperty(const JSString& function_name, bool enumerable = true) {
+      JSPropertyAttributeSet attributes { JSPropertyAttribute::DontDelete, JSPropertyAttribute::ReadOnly };
+      static_cast<void>(!enumerable && attributes.insert(JSPropertyAttribute::DontEnum));
+      HAL_DETAIL_JSEXPORTCLASSDEFINITIONBUILDER_LOCK_GUARD;
+      AddFunctionPropertyCallback(JSExportNamedFunctionPropertyCallback<T>(function_name, &JSExportClass<T>::template CallArgumentsFunctionThunk<Method>, attributes));
+      return *this;
+    }
+    
+    /*!
+     @method
+     
+     @abstract Add a function property whose implementation is a
+     member function of T, or of a base class of T, with a natural C++
+     signature. The attributes are the same as for the
+     AddFunctionProperty method that takes a callback.
+     
+     @discussion The arguments may be bool, double, int32_t, uint32_t,
+     std::string, JSString, JSValue, JSObject or JSValueView, by value
+     or by const reference. The result may be any of those types other
+     than JSObject and JSValueView, or void. For example, given this
+     class definition:
+     
+     class Foo {
+     double Scale(double factor, int32_t count, const std::string& unit);
+     };
+     
+     You would call the builder like this:
+     
+     builder.AddFunctionProperty<decltype(&Foo::Scale), &Foo::Scale>("scale");
+     
+     Calling the function from JavaScript with fewer arguments than
+     the member function takes throws a JavaScript exception. Extra
+     arguments are ignored.
+     
+     @result A reference to the builder for chaining.
+     */
+    template<typename F, F Method>
+    JSExportClassDefinitionBuilder<T>& AddFunctionProperty(const JSString& function_name, bool enumerable = true) {
+      JSPropertyAttributeSet attributes { JSPropertyAttribute::DontDelete, JSPropertyAttribute::ReadOnly };
+      static_cast<void>(!enumerable && attributes.insert(JSPropertyAttribute::DontEnum));
+      HAL_DETAIL_JSEXPORTCLASSDEFINITIONBUILDER_LOCK_GUARD;
+      AddFunctionPropertyCallback(JSExportNamedFunctionPropertyCallback<T>(function_name, &JSExportClass<T>::template CallNativeFunctionThunk<F, Method>, attributes));
+      return *this;
+    }
+    
     /*!
      @method
      
@@ -577,6 +751,33 @@ namespace HAL { namespace detail {
     JSExportClassDefinitionBuilder<T>& CallAsFunction(const CallAsFunctionCallback<T>& call_as_function_callback) HAL_NOEXCEPT {
       HAL_DETAIL_JSEXPORTCLASSDEFINITIONBUILDER_LOCK_GUARD;
       call_as_function_callback__ = call_as_function_callback;
+      call_as_function_thunk__    = nullptr;
+      return *this;
+    }
+    
+    /*!
+     @method
+     
+     @abstract Set a member function that takes its arguments as a
+     JSArguments to invoke when your JavaScript object is called as a
+     function, like this:
+     
+     builder.CallAsFunction<&Foo::DoSomething>();
+     
+     @discussion JavaScriptCore calls the member function through a
+     thunk generated at compile time, so there is no std::function
+     call, and the JSArguments is a view of the argument array, so no
+     std::vector or JSValue is created for the arguments. This
+     replaces a callback set by the other CallAsFunction method, and
+     vice versa.
+     
+     @result A reference to the builder for chaining.
+     */
+    template<JSValue (T::*Method)(const JSArguments&, JSObject&)>
+    JSExportClassDefinitionBuilder<T>& CallAsFunction() HAL_NOEXCEPT {
+      HAL_DETAIL_JSEXPORTCLASSDEFINITIONBUILDER_LOCK_GUARD;
+      call_as_function_callback__ = nullptr;
+      call_as_function_thunk__    = &JSExportClass<T>::template CallAsFunctionArgumentsThunk<Method>;
       return *this;
     }
     
@@ -625,6 +826,83 @@ namespace HAL { namespace detail {
       return *this;
     }
     
+    /*!
+     @method
+     
+     @abstract Return the callback to invoke when getting an array
+     index property's value from your JavaScript object.
+     */
+    GetIndexedPropertyCallback<T> GetIndexedProperty() const HAL_NOEXCEPT {
+      return get_indexed_property_callback__;
+    }
+    
+    /*!
+     @method
+     
+     @abstract Set the callback to invoke when getting an array index
+     property's value from your JavaScript object, e.g. obj[0].
+     
+     @discussion The index is parsed from the property name without
+     converting it to a std::string. Property names that are not array
+     indexes go to the GetProperty callback (if any).
+     
+     @result A reference to the builder for chaining.
+     */
+    JSExportClassDefinitionBuilder<T>& GetIndexedProperty(const GetIndexedPropertyCallback<T>& get_indexed_property_callback) HAL_NOEXCEPT {
+      HAL_DETAIL_JSEXPORTCLASSDEFINITIONBUILDER_LOCK_GUARD;
+      get_indexed_property_callback__ = get_indexed_property_callback;
+      return *this;
+    }
+    
+    /*!
+     @method
+     
+     @abstract Return the callback to invoke when setting an array
+     index property's value on your JavaScript object.
+     */
+    SetIndexedPropertyCallback<T> SetIndexedProperty() const HAL_NOEXCEPT {
+      return set_indexed_property_callback__;
+    }
+    
+    /*!
+     @method
+     
+     @abstract Set the callback to invoke when setting an array index
+     property's value on your JavaScript object, e.g. obj[0] = 1.
+     
+     @result A reference to the builder for chaining.
+     */
+    JSExportClassDefinitionBuilder<T>& SetIndexedProperty(const SetIndexedPropertyCallback<T>& set_indexed_property_callback) HAL_NOEXCEPT {
+      HAL_DETAIL_JSEXPORTCLASSDEFINITIONBUILDER_LOCK_GUARD;
+      set_indexed_property_callback__ = set_indexed_property_callback;
+      return *this;
+    }
+    
+    /*!
+     @method
+     
+     @abstract Return the callback to invoke when getting the 'length'
+     property of your JavaScript object.
+     */
+    GetLengthCallback<T> GetLength() const HAL_NOEXCEPT {
+      return get_length_callback__;
+    }
+    
+    /*!
+     @method
+     
+     @abstract Set the callback to invoke when getting the 'length'
+     property of your JavaScript object. The array indexes below the
+     length are also enumerated by JavaScript for...in loops.
+     
+     @result A reference to the builder for chaining.
+     */
+    JSExportClassDefinitionBuilder<T>& GetLength(const GetLengthCallback<T>& get_length_callback) HAL_NOEXCEPT {
+      HAL_DETAIL_JSEXPORTCLASSDEFINITIONBUILDER_LOCK_GUARD;
+      get_length_callback__ = get_length_callback;
+      return *this;
+    }
+    
     /*!
      @method
      
@@ -657,7 +935,11 @@ namespace HAL { namespace detail {
     DeletePropertyCallback<T>                     delete_property_callback__     { nullptr };
     GetPropertyNamesCallback<T>                   get_property_names_callback__  { nullptr };
     CallAsFunctionCallback<T>                     call_as_function_callback__    { nullptr };
+    ::JSObjectCallAsFunctionCallback              call_as_function_thunk__       { nullptr };
     ConvertToTypeCallback<T>                      convert_to_type_callback__     { nullptr };
+    GetIndexedPropertyCallback<T>                 get_indexed_property_callback__ { nullptr };
+    SetIndexedPropertyCallback<T>                 set_indexed_property_callback__ { nullptr };
+    GetLengthCallback<T>                          get_length_callback__           { nullptr };
     
     HAL_DETAIL_JSEXPORTCLASSDEFINITIONBUILDER_MUTEX;
   };
@@ -716,11 +998,13 @@ namespace HAL { namespace detail {
       js_class_definition__.hasProperty = JSExportClass<T>::JSObjectHasPropertyCallback;
     }
     
-    if (get_property_callback__) {
+    // The indexed and length callbacks are serviced by the same
+    // JavaScriptCore callbacks as the named ones.
+    if (get_property_callback__ || get_indexed_property_callback__ || get_length_callback__) {
       js_class_definition__.getProperty = JSExportClass<T>::JSObjectGetPropertyCallback;
     }
     
-    if (set_property_callback__) {
+    if (set_property_callback__ || set_indexed_property_callback__) {
       js_class_definition__.setProperty = JSExportClass<T>::JSObjectSetPropertyCallback;
     }
     
@@ -728,11 +1012,13 @@ namespace HAL { namespace detail {
       js_class_definition__.deleteProperty = JSExportClass<T>::JSObjectDeletePropertyCallback;
     }
     
-    if (get_property_names_callback__) {
+    if (get_property_names_callback__ || get_length_callback__) {
       js_class_definition__.getPropertyNames = JSExportClass<T>::JSObjectGetPropertyNamesCallback;
     }
     
-    if (call_as_function_callback__) {
+    if (call_as_function_thunk__) {
+      js_class_definition__.callAsFunction = call_as_function_thunk__;
+    } else if (call_as_function_callback__) {
       js_class_definition__.callAsFunction = JSExportClass<T>::JSObjectCallAsFunctionCallback;
     }
     
@@ -746,7 +1032,6 @@ namespace HAL { namespace detail {
   template<typename T>
   JSExportClassDefinition<T>::JSExportClassDefinition(const JSExportClassDefinitionBuilder<T>& builder)
   : JSClassDefinition(builder.js_class_definition__)
-  , named_value_property_callback_map__(builder.named_value_property_callback_map__)
   , named_function_property_callback_map__(builder.named_function_property_callback_map__)
   , has_property_callback__(builder.has_property_callback__)
   , get_property_callback__(builder.get_property_callback__)
@@ -754,7 +1039,21 @@ namespace HAL { namespace detail {
   , delete_property_callback__(builder.delete_property_callback__)
   , get_property_names_callback__(builder.get_property_names_callback__)
   , call_as_function_callback__(builder.call_as_function_callback__)
-  , convert_to_type_callback__(builder.convert_to_type_callback__) {
+  , convert_to_type_callback__(builder.convert_to_type_callback__)
+  , get_indexed_property_callback__(builder.get_indexed_property_callback__)
+  , set_indexed_property_callback__(builder.set_indexed_property_callback__)
+  , get_length_callback__(builder.get_length_callback__) {
+    // Freeze the value properties into a vector sorted by UTF-16 name,
+    // so that JSExportClass can find a property's callback by index,
+    // or else by a binary search that never converts the name.
+    named_value_properties__.reserve(builder.named_value_property_callback_map__.size());
+    for (const auto& entry : builder.named_value_property_callback_map__) {
+      named_value_properties__.push_back({entry.first, static_cast<std::u16string>(JSString(entry.first)), entry.second});
+    }
+    std::sort(named_value_properties__.begin(), named_value_properties__.end(), [](const JSExportNamedValueProperty<T>& lhs, const JSExportNamedValueProperty<T>& rhs) {
+        return lhs.u16name < rhs.u16name;
+      });
+    
     InitializeNamedPropertyCallbacks();
   }
   
@@ -71,12 +71,33 @@ namespace HAL { namespace detail {
      */
     JSExportNamedFunctionPropertyCallback(const std::string& function_name,
                                           CallNamedFunctionCallback<T> function_callback,
-                                          const std::unordered_set<JSPropertyAttribute>& attributes);
+                                          JSPropertyAttributeSet attributes);
     
-    CallNamedFunctionCallback<T> function_callback() const {
+    /*!
+     @method
+     
+     @abstract Create a function property whose JavaScriptCore
+     callback is given directly, e.g. a thunk generated at compile
+     time for a member function by
+     JSExport<T>::AddFunctionProperty<&T::method>.
+     
+     @throws std::invalid_argument exception if function_name is
+     empty or js_function_callback is nullptr.
+     */
+    JSExportNamedFunctionPropertyCallback(const std::string& function_name,
+                                          JSObjectCallAsFunctionCallback js_function_callback,
+                                          JSPropertyAttributeSet attributes);
+    
+    const CallNamedFunctionCallback<T>& function_callback() const HAL_NOEXCEPT {
       return function_callback__;
     }
     
+    // Return the JavaScriptCore callback given to the constructor, or
+    // nullptr if this function property uses function_callback().
+    JSObjectCallAsFunctionCallback get_js_function_callback() const HAL_NOEXCEPT {
+      return js_function_callback__;
+    }
+    
     ~JSExportNamedFunctionPropertyCallback()                                                       = default;
     JSExportNamedFunctionPropertyCallback(const JSExportNamedFunctionPropertyCallback&)            HAL_NOEXCEPT;
     JSExportNamedFunctionPropertyCallback(JSExportNamedFunctionPropertyCallback&&)                 HAL_NOEXCEPT;
@@ -89,14 +110,15 @@ namespace HAL { namespace detail {
     template<typename U>
     friend bool operator==(const JSExportNamedFunctionPropertyCallback<U>& lhs, const JSExportNamedFunctionPropertyCallback<U>& rhs) HAL_NOEXCEPT;
     
-    CallNamedFunctionCallback<T> function_callback__ { nullptr };
+    CallNamedFunctionCallback<T>   function_callback__    { nullptr };
+    JSObjectCallAsFunctionCallback js_function_callback__ { nullptr };
   };
   
   template<typename T>
   JSExportNamedFunctionPropertyCallback<T>::JSExportNamedFunctionPropertyCallback(
                                                                                   const std::string& function_name,
                                                                                   CallNamedFunctionCallback<T> function_callback,
-                                                                                  const std::unordered_set<JSPropertyAttribute>& attributes)
+                                                                                  JSPropertyAttributeSet attributes)
   : JSPropertyCallback(function_name, attributes)
   , function_callback__(function_callback) {
     
@@ -105,23 +127,39 @@ namespace HAL { namespace detail {
     }
   }
   
+  template<typename T>
+  JSExportNamedFunctionPropertyCallback<T>::JSExportNamedFunctionPropertyCallback(
+                                                                                  const std::string& function_name,
+                                                                                  JSObjectCallAsFunctionCallback js_function_callback,
+                                                                                  JSPropertyAttributeSet attributes)
+  : JSPropertyCallback(function_name, attributes)
+  , js_function_callback__(js_function_callback) {
+    
+    if (!js_function_callback) {
+      ThrowInvalidArgument("JSExportNamedFunctionPropertyCallback", "js_function_callback is missing");
+    }
+  }
+  
   template<typename T>
   JSExportNamedFunctionPropertyCallback<T>::JSExportNamedFunctionPropertyCallback(const JSExportNamedFunctionPropertyCallback& rhs) HAL_NOEXCEPT
   : JSPropertyCallback(rhs)
-  , function_callback__(rhs.function_callback__) {
+  , function_callback__(rhs.function_callback__)
+  , js_function_callback__(rhs.js_function_callback__) {
   }
   
   template<typename T>
   JSExportNamedFunctionPropertyCallback<T>::JSExportNamedFunctionPropertyCallback(JSExportNamedFunctionPropertyCallback&& rhs) HAL_NOEXCEPT
   : JSPropertyCallback(rhs)
-  , function_callback__(std::move(rhs.function_callback__)) {
+  , function_callback__(std::move(rhs.function_callback__))
+  , js_function_callback__(rhs.js_function_callback__) {
   }
   
   template<typename T>
   JSExportNamedFunctionPropertyCallback<T>& JSExportNamedFunctionPropertyCallback<T>::operator=(const JSExportNamedFunctionPropertyCallback<T>& rhs) HAL_NOEXCEPT {
     HAL_DETAIL_JSPROPERTYCALLBACK_LOCK_GUARD;
     JSPropertyCallback::operator=(rhs);
-    function_callback__ = rhs.function_callback__;
+    function_callback__    = rhs.function_callback__;
+    js_function_callback__ = rhs.js_function_callback__;
     return *this;
   }
   
@@ -140,7 +178,8 @@ namespace HAL { namespace detail {
     
     // By swapping the members of two classes, the two classes are
     // effectively swapped.
-    swap(function_callback__, other.function_callback__);
+    swap(function_callback__   , other.function_callback__);
+    swap(js_function_callback__, other.js_function_callback__);
   }
   
   template<typename T>
@@ -160,6 +199,10 @@ namespace HAL { namespace detail {
       return false;
     }
     
+    if (lhs.js_function_callback__ != rhs.js_function_callback__) {
+      return false;
+    }
+    
     return static_cast<JSPropertyCallback>(lhs) == static_cast<JSPropertyCallback>(rhs);
   }
   
@@ -64,16 +64,50 @@ namespace HAL { namespace detail {
     JSExportNamedValuePropertyCallback(const std::string& property_name,
                                        GetNamedValuePropertyCallback<T> get_callback,
                                        SetNamedValuePropertyCallback<T> set_callback,
-                                       const std::unordered_set<JSPropertyAttribute>& attributes);
+                                       JSPropertyAttributeSet attributes);
     
-    GetNamedValuePropertyCallback<T> get_callback() const HAL_NOEXCEPT {
+    /*!
+     @method
+     
+     @abstract Create a value property whose JavaScriptCore callbacks
+     are given directly, e.g. thunks generated at compile time for
+     member functions by JSExport<T>::AddValueProperty<&T::get,
+     &T::set>.
+     
+     @discussion The preconditions are the same as for the
+     constructor taking GetNamedValuePropertyCallback and
+     SetNamedValuePropertyCallback.
+     */
+    JSExportNamedValuePropertyCallback(const std::string& property_name,
+                                       JSObjectGetPropertyCallback js_get_callback,
+                                       JSObjectSetPropertyCallback js_set_callback,
+                                       JSPropertyAttributeSet attributes);
+    
+    const GetNamedValuePropertyCallback<T>& get_callback() const HAL_NOEXCEPT {
       return get_callback__;
     }
     
-    SetNamedValuePropertyCallback<T> set_callback() const HAL_NOEXCEPT {
+    const SetNamedValuePropertyCallback<T>& set_callback() const HAL_NOEXCEPT {
       return set_callback__;
     }
     
+    // Return the JavaScriptCore callbacks given to the constructor, or
+    // nullptr if this value property uses get_callback() and
+    // set_callback().
+    JSObjectGetPropertyCallback get_js_get_callback() const HAL_NOEXCEPT {
+      return js_get_callback__;
+    }
+    
+    JSObjectSetPropertyCallback get_js_set_callback() const HAL_NOEXCEPT {
+      return js_set_callback__;
+    }
+    
+    // Return true if this value property was created with
+    // JavaScriptCore callbacks.
+    bool has_js_callbacks() const HAL_NOEXCEPT {
+      return js_get_callback__ || js_set_callback__;
+    }
+    
     ~JSExportNamedValuePropertyCallback()                                                    = default;
     JSExportNamedValuePropertyCallback(const JSExportNamedValuePropertyCallback&)            HAL_NOEXCEPT;
     JSExportNamedValuePropertyCallback(JSExportNamedValuePropertyCallback&&)                 HAL_NOEXCEPT;
@@ -86,8 +120,13 @@ namespace HAL { namespace detail {
     template<typename U>
     friend bool operator==(const JSExportNamedValuePropertyCallback<U>& lhs, const JSExportNamedValuePropertyCallback<U>& rhs) HAL_NOEXCEPT;
     
+    // Check the preconditions shared by both constructors.
+    void Validate(bool has_get_callback, bool has_set_callback);
+    
     GetNamedValuePropertyCallback<T> get_callback__;
     SetNamedValuePropertyCallback<T> set_callback__;
+    JSObjectGetPropertyCallback      js_get_callback__ { nullptr };
+    JSObjectSetPropertyCallback      js_set_callback__ { nullptr };
   };
   
   template<typename T>
@@ -95,28 +134,44 @@ namespace HAL { namespace detail {
                                                                             const std::string& property_name,
                                                                             GetNamedValuePropertyCallback<T> get_callback,
                                                                             SetNamedValuePropertyCallback<T> set_callback,
-                                                                            const std::unordered_set<JSPropertyAttribute>& attributes)
+                                                                            JSPropertyAttributeSet attributes)
   : JSPropertyCallback(property_name, attributes)
   , get_callback__(get_callback)
   , set_callback__(set_callback) {
-    
-    if (!get_callback && !set_callback) {
+    Validate(static_cast<bool>(get_callback), static_cast<bool>(set_callback));
+  }
+  
+  template<typename T>
+  JSExportNamedValuePropertyCallback<T>::JSExportNamedValuePropertyCallback(
+                                                                            const std::string& property_name,
+                                                                            JSObjectGetPropertyCallback js_get_callback,
+                                                                            JSObjectSetPropertyCallback js_set_callback,
+                                                                            JSPropertyAttributeSet attributes)
+  : JSPropertyCallback(property_name, attributes)
+  , js_get_callback__(js_get_callback)
+  , js_set_callback__(js_set_callback) {
+    Validate(js_get_callback != nullptr, js_set_callback != nullptr);
+  }
+  
+  template<typename T>
+  void JSExportNamedValuePropertyCallback<T>::Validate(bool has_get_callback, bool has_set_callback) {
+    if (!has_get_callback && !has_set_callback) {
       ThrowInvalidArgument("JSExportNamedValuePropertyCallback", "Both get_callback and set_callback are missing. At least one callback must be provided");
     }
     
-    if (attributes.find(JSPropertyAttribute::ReadOnly) != attributes.end()) {
-      if (!get_callback) {
+    if (attributes__.count(JSPropertyAttribute::ReadOnly)) {
+      if (!has_get_callback) {
         ThrowInvalidArgument("JSExportNamedValuePropertyCallback", "ReadOnly attribute is set but get_callback is missing");
       }
       
-      if (set_callback) {
+      if (has_set_callback) {
         ThrowInvalidArgument("JSExportNamedValuePropertyCallback", "ReadOnly attribute is set but set_callback is provided");
       }
     }
     
     // Force the ReadOnly attribute if only the get_callback is
     // provided.
-    if (get_callback && !set_callback) {
+    if (has_get_callback && !has_set_callback) {
       attributes__.insert(JSPropertyAttribute::ReadOnly);
     }
   }
@@ -125,22 +180,28 @@ namespace HAL { namespace detail {
   JSExportNamedValuePropertyCallback<T>::JSExportNamedValuePropertyCallback(const JSExportNamedValuePropertyCallback& rhs) HAL_NOEXCEPT
   : JSPropertyCallback(rhs)
   , get_callback__(rhs.get_callback__)
-  , set_callback__(rhs.set_callback__) {
+  , set_callback__(rhs.set_callback__)
+  , js_get_callback__(rhs.js_get_callback__)
+  , js_set_callback__(rhs.js_set_callback__) {
   }
   
   template<typename T>
   JSExportNamedValuePropertyCallback<T>::JSExportNamedValuePropertyCallback(JSExportNamedValuePropertyCallback&& rhs) HAL_NOEXCEPT
   : JSPropertyCallback(rhs)
   , get_callback__(std::move(rhs.get_callback__))
-  , set_callback__(std::move(rhs.set_callback__)) {
+  , set_callback__(std::move(rhs.set_callback__))
+  , js_get_callback__(rhs.js_get_callback__)
+  , js_set_callback__(rhs.js_set_callback__) {
   }
   
   template<typename T>
   JSExportNamedValuePropertyCallback<T>& JSExportNamedValuePropertyCallback<T>::operator=(const JSExportNamedValuePropertyCallback<T>& rhs) HAL_NOEXCEPT {
     HAL_DETAIL_JSPROPERTYCALLBACK_LOCK_GUARD;
     JSPropertyCallback::operator=(rhs);
-    get_callback__ = rhs.get_callback__;
-    set_callback__ = rhs.set_callback__;
+    get_callback__    = rhs.get_callback__;
+    set_callback__    = rhs.set_callback__;
+    js_get_callback__ = rhs.js_get_callback__;
+    js_set_callback__ = rhs.js_set_callback__;
     return *this;
   }
   
@@ -159,8 +220,10 @@ namespace HAL { namespace detail {
     
     // By swapping the members of two classes, the two classes are
     // effectively swapped.
-    swap(get_callback__, other.get_callback__);
-    swap(set_callback__, other.set_callback__);
+    swap(get_callback__   , other.get_callback__);
+    swap(set_callback__   , other.set_callback__);
+    swap(js_get_callback__, other.js_get_callback__);
+    swap(js_set_callback__, other.js_set_callback__);
   }
   
   template<typename T>
@@ -190,6 +253,11 @@ namespace HAL { namespace detail {
       return false;
     }
     
+    // js_get_callback__ and js_set_callback__
+    if (lhs.js_get_callback__ != rhs.js_get_callback__ || lhs.js_set_callback__ != rhs.js_set_callback__) {
+      return false;
+    }
+    
     return static_cast<JSPropertyCallback>(lhs) == static_cast<JSPropertyCallback>(rhs);
   }
   
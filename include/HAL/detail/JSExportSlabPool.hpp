@@ -0,0 +1,181 @@
+/**
+ * HAL
+ *
+ * Copyright (c) 2014 by Appcelerator, Inc. All Rights Reserved.
+ * Licensed under the terms of the Apache Public License.
+ * Please see the LICENSE included with this distribution for details.
+ */
+
+#ifndef _HAL_DETAIL_JSEXPORTSLABPOOL_HPP_
+#define _HAL_DETAIL_JSEXPORTSLABPOOL_HPP_
+
+#include "HAL/detail/JSBase.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <map>
+#include <vector>
+
+#ifdef HAL_THREAD_SAFE
+#include <mutex>
+#endif
+
+namespace HAL {
+
+  /*!
+   @struct
+
+   @discussion The occupancy of the pool behind a
+   JSExportPoolAllocator.
+   */
+  struct JSExportPoolStatistics {
+
+    // The size in bytes of one slot, which is the size of the native
+    // object rounded up to its alignment.
+    std::size_t slot_size         { 0 };
+
+    // The number of slots in one slab.
+    std::size_t slots_per_slab    { 0 };
+
+    // The number of slabs allocated so far. Slabs are never returned
+    // to the system.
+    std::size_t slab_count        { 0 };
+
+    // The number of native objects currently allocated from the pool.
+    std::size_t in_use            { 0 };
+
+    // The largest value in_use has had.
+    std::size_t peak_in_use       { 0 };
+
+    // The number of native objects ever allocated from the pool.
+    std::size_t total_allocations { 0 };
+
+    // Return the number of slots in all slabs.
+    std::size_t capacity() const HAL_NOEXCEPT {
+      return slab_count * slots_per_slab;
+    }
+  };
+
+} // namespace HAL {
+
+namespace HAL { namespace detail {
+
+  /*!
+   @class
+
+   @discussion A pool of fixed size slots carved out of large slabs,
+   for the native objects of one JSExport class. Freed slots go onto
+   a free list and are reused before a new slab is allocated, so
+   objects that are created and finalized at a high rate don't go
+   through the general purpose allocator.
+
+   The slabs are allocated with ::operator new, so the slots are
+   suitably aligned for any type whose alignment is no stricter than
+   std::max_align_t.
+   */
+  class HAL_EXPORT JSExportSlabPool final {
+
+  public:
+
+    JSExportSlabPool(std::size_t object_size, std::size_t object_alignment, std::size_t slots_per_slab);
+    ~JSExportSlabPool() HAL_NOEXCEPT;
+
+    JSExportSlabPool(const JSExportSlabPool&)            = delete;
+    JSExportSlabPool& operator=(const JSExportSlabPool&) = delete;
+
+    /*!
+     @method
+
+     @abstract Return uninitialized storage for one object.
+
+     @throws std::bad_alloc if a new slab can't be allocated.
+     */
+    void* Allocate();
+
+    /*!
+     @method
+
+     @abstract Return storage obtained from Allocate to the pool. The
+     object in it must already have been destroyed.
+     */
+    void Deallocate(void* slot) HAL_NOEXCEPT;
+
+    JSExportPoolStatistics get_statistics() const HAL_NOEXCEPT;
+
+    /*!
+     @method
+
+     @abstract Return true if slot is storage in a slab of this pool.
+     */
+    bool Owns(const void* slot) const HAL_NOEXCEPT;
+
+    /*!
+     @method
+
+     @abstract Return slot to the pool that owns it, for storage whose
+     pool isn't known. Finding the pool takes time logarithmic in the
+     number of slabs of all pools.
+
+     @result true if a pool owns slot, otherwise false, in which case
+     nothing is done.
+     */
+    static bool DeallocateIfPooled(void* slot) HAL_NOEXCEPT;
+
+    /*!
+     @method
+
+     @abstract Return the pool that pool_ptr points to, creating it
+     the first time. The pool is created under a lock, because MSVC
+     2013 doesn't initialize function-local statics thread-safely.
+
+     @throws std::bad_alloc if the pool can't be allocated.
+     */
+    static JSExportSlabPool& GetOrCreate(std::atomic<JSExportSlabPool*>& pool_ptr, std::size_t object_size, std::size_t object_alignment, std::size_t slots_per_slab);
+
+  private:
+
+    struct FreeSlot {
+      FreeSlot* next;
+    };
+
+    struct SlabIndexEntry {
+      const unsigned char* end;
+      JSExportSlabPool*    pool;
+    };
+
+    void AllocateSlab();
+
+    // Return the pool that owns slot, or nullptr if there is none.
+    static JSExportSlabPool* FindPool(const void* slot) HAL_NOEXCEPT;
+
+    // Silence 4251 on Windows since private member variables do not
+    // need to be exported from a DLL.
+#pragma warning(push)
+#pragma warning(disable: 4251)
+    std::vector<void*>     slabs__;
+    FreeSlot*              free_list__ { nullptr };
+    JSExportPoolStatistics statistics__;
+#pragma warning(pop)
+
+    // The slabs of every pool by address, so that FindPool can find
+    // the slab that contains a slot with a binary search. Only call it
+    // under the static lock, which also makes its first call
+    // thread-safe.
+    static std::map<const unsigned char*, SlabIndexEntry>& GetSlabIndex() HAL_NOEXCEPT;
+
+#undef  HAL_DETAIL_JSEXPORTSLABPOOL_LOCK_GUARD
+#undef  HAL_DETAIL_JSEXPORTSLABPOOL_LOCK_GUARD_STATIC
+#ifdef  HAL_THREAD_SAFE
+    mutable std::mutex mutex__;
+    static  std::mutex mutex_static__;
+#define HAL_DETAIL_JSEXPORTSLABPOOL_LOCK_GUARD std::lock_guard<std::mutex> lock(mutex__)
+#define HAL_DETAIL_JSEXPORTSLABPOOL_LOCK_GUARD_STATIC std::lock_guard<std::mutex> lock_static(JSExportSlabPool::mutex_static__)
+#else
+#define HAL_DETAIL_JSEXPORTSLABPOOL_LOCK_GUARD
+#define HAL_DETAIL_JSEXPORTSLABPOOL_LOCK_GUARD_STATIC
+#endif  // HAL_THREAD_SAFE
+  };
+
+}} // namespace HAL { namespace detail {
+
+#endif // _HAL_DETAIL_JSEXPORTSLABPOOL_HPP_
@@ -0,0 +1,49 @@
+/**
+ * HAL
+ *
+ * Copyright (c) 2014 by Appcelerator, Inc. All Rights Reserved.
+ * Licensed under the terms of the Apache Public License.
+ * Please see the LICENSE included with this distribution for details.
+ */
+
+#ifndef _HAL_DETAIL_JSMAPPEDFILE_HPP_
+#define _HAL_DETAIL_JSMAPPEDFILE_HPP_
+
+#include "HAL/detail/JSBase.hpp"
+
+#include <cstddef>
+#include <string>
+
+namespace HAL { namespace detail {
+
+  /*!
+   @function
+
+   @abstract Memory map a whole file copy-on-write.
+
+   @discussion The mapping is readable and writable, but writes go to
+   private pages and never reach the file. This keeps the mapping safe
+   to hand to JavaScript, which can write to any ArrayBuffer. The OS
+   pages the data in on demand.
+
+   @param path The path of the file to map.
+
+   @param byte_length Set to the size of the file.
+
+   @result The address of the mapping, or nullptr if the file is
+   empty.
+
+   @throws std::runtime_error if the file can't be opened or mapped.
+   */
+  HAL_EXPORT void* MapFile(const std::string& path, std::size_t& byte_length);
+
+  /*!
+   @function
+
+   @abstract Unmap a mapping returned by MapFile.
+   */
+  HAL_EXPORT void UnmapFile(void* bytes, std::size_t byte_length) HAL_NOEXCEPT;
+
+}} // namespace HAL { namespace detail {
+
+#endif // _HAL_DETAIL_JSMAPPEDFILE_HPP_
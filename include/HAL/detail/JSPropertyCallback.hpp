@@ -13,7 +13,6 @@
 #include "HAL/JSPropertyAttribute.hpp"
 
 #include <string>
-#include <unordered_set>
 
 namespace HAL { namespace detail {
   
@@ -43,13 +42,13 @@ namespace HAL { namespace detail {
      
      @throws std::invalid_argument if property_name is empty.
      */
-    JSPropertyCallback(const std::string& name, const std::unordered_set<JSPropertyAttribute, std::hash<JSPropertyAttribute>>& attributes);
+    JSPropertyCallback(const std::string& name, JSPropertyAttributeSet attributes);
     
     virtual std::string get_name() const HAL_NOEXCEPT final {
       return name__;
     }
     
-    virtual std::unordered_set<JSPropertyAttribute> get_attributes() const HAL_NOEXCEPT final {
+    virtual JSPropertyAttributeSet get_attributes() const HAL_NOEXCEPT final {
       return attributes__;
     }
     
@@ -77,7 +76,7 @@ namespace HAL { namespace detail {
     // need to be exported from a DLL.
 #pragma warning(push)
 #pragma warning(disable: 4251)
-    std::unordered_set<JSPropertyAttribute> attributes__;
+    JSPropertyAttributeSet attributes__;
 #pragma warning(pop)
     
 #undef HAL_DETAIL_JSPROPERTYCALLBACK_LOCK_GUARD
@@ -97,7 +96,7 @@ namespace HAL { namespace detail {
   // Return true if the two JSPropertyCallbacks are equal.
   inline
   bool operator==(const JSPropertyCallback& lhs, const JSPropertyCallback& rhs) HAL_NOEXCEPT {
-    return (lhs.name__ != rhs.name__) && (lhs.attributes__ == rhs.attributes__);
+    return (lhs.name__ == rhs.name__) && (lhs.attributes__ == rhs.attributes__);
   }
   
   // Return true if the two JSPropertyCallback are not equal.
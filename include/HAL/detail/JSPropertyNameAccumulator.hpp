@@ -11,6 +11,7 @@
 
 #include "HAL/detail/JSBase.hpp"
 #include "HAL/JSString.hpp"
+#include "HAL/JSStringView.hpp"
 #include <iostream>
 #include <cassert>
 
@@ -58,6 +59,10 @@ namespace HAL {
         JSPropertyNameAccumulatorAddName(js_property_name_accumulator_ref__, static_cast<JSStringRef>(property_name));
       }
       
+      void AddName(const JSStringView& property_name) const {
+        JSPropertyNameAccumulatorAddName(js_property_name_accumulator_ref__, static_cast<JSStringRef>(property_name));
+      }
+      
     private:
       
       // Only a JSObject and a JSExportClass can create a
@@ -0,0 +1,81 @@
+/**
+ * HAL
+ *
+ * Copyright (c) 2014 by Appcelerator, Inc. All Rights Reserved.
+ * Licensed under the terms of the Apache Public License.
+ * Please see the LICENSE included with this distribution for details.
+ */
+
+#ifndef _HAL_DETAIL_JSTYPEDARRAYBASE_HPP_
+#define _HAL_DETAIL_JSTYPEDARRAYBASE_HPP_
+
+#include "HAL/JSObject.hpp"
+#include "HAL/JSArrayBuffer.hpp"
+
+#include <cstddef>
+
+namespace HAL { namespace detail {
+
+  /*!
+   @class
+
+   @discussion The element type independent part of JSTypedArray.
+   */
+  class HAL_EXPORT JSTypedArrayBase : public JSObject HAL_PERFORMANCE_COUNTER2(JSTypedArrayBase) {
+
+  public:
+
+    /*!
+     @method
+
+     @abstract Return the number of elements in this typed array.
+     */
+    virtual std::size_t GetLength() const HAL_NOEXCEPT final;
+
+    /*!
+     @method
+
+     @abstract Return the number of bytes in this typed array.
+     */
+    virtual std::size_t GetByteLength() const HAL_NOEXCEPT final;
+
+    /*!
+     @method
+
+     @abstract Return the offset in bytes of this typed array's first
+     element within its ArrayBuffer.
+     */
+    virtual std::size_t GetByteOffset() const HAL_NOEXCEPT final;
+
+    /*!
+     @method
+
+     @abstract Return the ArrayBuffer that holds this typed array's
+     elements.
+     */
+    virtual JSArrayBuffer GetBuffer() const final;
+
+  protected:
+
+    // Wrap an existing typed array, throwing std::invalid_argument if
+    // its element type isn't js_typed_array_type.
+    JSTypedArrayBase(const JSContext& js_context, JSObjectRef js_object_ref, JSTypedArrayType js_typed_array_type);
+
+    // Return a pointer to this typed array's first element, or
+    // nullptr if it is empty or its buffer is detached.
+    void* GetBytesPtr() const HAL_NOEXCEPT;
+
+    // Create a typed array of length zero-initialized elements.
+    static JSObjectRef MakeTypedArray(const JSContext& js_context, JSTypedArrayType js_typed_array_type, std::size_t length);
+
+    // Create a typed array over native memory without copying it.
+    static JSObjectRef MakeTypedArray(const JSContext& js_context, JSTypedArrayType js_typed_array_type, void* bytes, std::size_t byte_length, JSBytesDeallocator deallocator);
+
+    // Create a typed array view of length elements of js_array_buffer
+    // starting at byte_offset.
+    static JSObjectRef MakeTypedArray(const JSContext& js_context, JSTypedArrayType js_typed_array_type, const JSArrayBuffer& js_array_buffer, std::size_t byte_offset, std::size_t length);
+  };
+
+}} // namespace HAL { namespace detail {
+
+#endif // _HAL_DETAIL_JSTYPEDARRAYBASE_HPP_
@@ -15,6 +15,7 @@
 #include "HAL/JSValue.hpp"
 
 #include <string>
+#include <stdexcept>
 #include <cstdint>
 #include <memory>
 #include <vector>
@@ -35,33 +36,48 @@ namespace HAL { namespace detail {
     return std::unique_ptr<T>(new T(std::forward<Ts>(params)...));
   }
 
-  class js_runtime_error : public std::runtime_error {
+  /*!
+   @class
+   
+   @discussion The exception thrown by ThrowRuntimeError for a
+   JavaScript exception. It holds the thrown JavaScript value and
+   reads the details (name, message, file name, line number and
+   stack) off it only when they are asked for, so an exception that
+   is caught and discarded costs no property lookups.
+   
+   file name and line number fall back to the source URL and line
+   number of the script that threw, if the thrown value doesn't carry
+   its own.
+   */
+  class HAL_EXPORT js_runtime_error : public std::runtime_error {
   public:
-    js_runtime_error() HAL_NOEXCEPT = default;
+    js_runtime_error(const JSValue& js_value, const std::string& source_url = "", int line_number = 0);
     js_runtime_error(const JSError& js_error);
-    virtual ~js_runtime_error() = default;
-
-    std::string js_name() const {
-      return js_name__;
-    }
-    std::string js_message() const {
-      return js_message__;
-    }
-    std::string js_filename() const {
-      return js_filename__;
-    }
-    std::uint32_t js_linenumber() const {
-      return js_linenumber__;
-    }
-    std::vector<JSValue> js_stack() const {
-      return js_stack__;
+    virtual ~js_runtime_error() HAL_NOEXCEPT = default;
+    
+    // The message is computed on the first call.
+    virtual const char* what() const HAL_NOEXCEPT override;
+    
+    JSValue js_value() const HAL_NOEXCEPT {
+      return js_value__;
     }
+    std::string js_name() const;
+    std::string js_message() const;
+    std::string js_filename() const;
+    std::uint32_t js_linenumber() const;
+    std::vector<JSValue> js_stack() const;
+    
   private:
-    std::string js_name__;
-    std::string js_message__;
-    std::string js_filename__;
-    std::uint32_t js_linenumber__;
-    std::vector<JSValue> js_stack__;
+    // Silence 4251 on Windows since private member variables do not
+    // need to be exported from a DLL.
+#pragma warning(push)
+#pragma warning(disable: 4251)
+    JSValue js_value__;
+    std::string source_url__;
+    int line_number__;
+    mutable std::string what__;
+    mutable bool what_materialized__ { false };
+#pragma warning(pop)
   };
 
   HAL_EXPORT void    ThrowRuntimeError(const std::string& internal_component_name, const std::string& message);
@@ -77,10 +93,10 @@ namespace HAL { namespace detail {
   // For interoperability with the JavaScriptCore C API.
   
   // typedef unsigned JSPropertyAttributes
-  HAL_EXPORT unsigned ToJSPropertyAttributes(const std::unordered_set<JSPropertyAttribute>& attributes)          HAL_NOEXCEPT;
-  HAL_EXPORT std::unordered_set<JSPropertyAttribute> FromJSPropertyAttributes(::JSPropertyAttributes attributes) HAL_NOEXCEPT;
+  HAL_EXPORT unsigned ToJSPropertyAttributes(JSPropertyAttributeSet attributes)                                 HAL_NOEXCEPT;
+  HAL_EXPORT JSPropertyAttributeSet FromJSPropertyAttributes(::JSPropertyAttributes attributes)                  HAL_NOEXCEPT;
   HAL_EXPORT std::string to_string(JSPropertyAttribute)                                                          HAL_NOEXCEPT;
-  HAL_EXPORT std::string to_string(const std::unordered_set<JSPropertyAttribute>& attributes)                    HAL_NOEXCEPT;
+  HAL_EXPORT std::string to_string(JSPropertyAttributeSet attributes)                                            HAL_NOEXCEPT;
   HAL_EXPORT std::string to_string_JSPropertyAttributes(::JSPropertyAttributes attributes)                       HAL_NOEXCEPT;
   
   HAL_EXPORT unsigned ToJSClassAttribute(JSClassAttribute attribute)                                             HAL_NOEXCEPT;
@@ -99,6 +115,13 @@ namespace HAL { namespace detail {
   // representation.
   HAL_EXPORT int32_t to_int32_t(double number);
   
+  // Return true and set index if property_name_ref is an array index
+  // as defined in section 15.4 of the ECMA-262 spec, i.e. the
+  // canonical decimal representation of an integer less than
+  // 2^32 - 1. The characters are read in place, without converting
+  // the property name to a std::string.
+  HAL_EXPORT bool ToArrayIndex(JSStringRef property_name_ref, unsigned& index) HAL_NOEXCEPT;
+  
 }} // namespace HAL { namespace detail {
 
 #endif // _HAL_DETAIL_JSUTIL_HPP_
@@ -0,0 +1,121 @@
+/**
+ * HAL
+ *
+ * Copyright (c) 2014 by Appcelerator, Inc. All Rights Reserved.
+ * Licensed under the terms of the Apache Public License.
+ * Please see the LICENSE included with this distribution for details.
+ */
+
+#ifndef _HAL_DETAIL_JSWEAKMAPBASE_HPP_
+#define _HAL_DETAIL_JSWEAKMAPBASE_HPP_
+
+#include "HAL/detail/JSBase.hpp"
+#include "HAL/JSString.hpp"
+
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+
+namespace HAL {
+  class JSObject;
+}
+
+namespace HAL { namespace detail {
+
+  /*!
+   @class
+
+   @discussion The type independent part of JSWeakMap.
+
+   The JavaScriptCore C API has no weak references, so JSWeakMapBase
+   learns about the death of a key by attaching a small "sentinel"
+   object to it as a non-enumerable property. The sentinel is only
+   reachable through its key, so it is garbage collected together with
+   the key, and its finalizer removes the entry. Neither the key nor
+   the sentinel is protected.
+
+   Every lookup checks that the key still carries this table's
+   sentinel, so an entry whose key was collected (and whose address may
+   have been reused) before the sentinel's finalizer ran is never
+   returned.
+   */
+  class HAL_EXPORT JSWeakMapBase : public std::enable_shared_from_this<JSWeakMapBase> {
+
+  public:
+
+    virtual ~JSWeakMapBase() HAL_NOEXCEPT;
+
+    JSWeakMapBase(const JSWeakMapBase&)            = delete;
+    JSWeakMapBase& operator=(const JSWeakMapBase&) = delete;
+
+  protected:
+
+    JSWeakMapBase();
+
+    /*!
+     @method
+
+     @abstract Attach this table's sentinel to a JavaScript object
+     unless it already carries one.
+
+     @result The identity key of js_object.
+
+     @throws std::invalid_argument if js_object does not accept new
+     properties, e.g. because it is frozen.
+     */
+    std::intptr_t Attach(const JSObject& js_object);
+
+    /*!
+     @method
+
+     @abstract Determine whether a JavaScript object carries this
+     table's sentinel. A stale entry for the object's key is dropped
+     (see Finalize) as a side effect.
+     */
+    bool IsAttached(const JSObject& js_object);
+
+    /*!
+     @method
+
+     @abstract Remove this table's sentinel from a JavaScript object.
+
+     @result true if the object carried this table's sentinel.
+     */
+    bool Detach(const JSObject& js_object);
+
+    /*!
+     @method
+
+     @abstract Forget every sentinel without touching the keys, whose
+     sentinels become inert.
+     */
+    void DetachAll() HAL_NOEXCEPT;
+
+    /*!
+     @method
+
+     @abstract Called when the JavaScript object with the given
+     identity key is gone. Derived classes erase their entry for the
+     key.
+     */
+    virtual void Finalize(std::intptr_t key) HAL_NOEXCEPT = 0;
+
+    static std::intptr_t GetKey(const JSObject& js_object) HAL_NOEXCEPT;
+
+  private:
+
+    static void FinalizeSentinel(JSObjectRef js_object_ref);
+    static JSClassRef GetSentinelClass() HAL_NOEXCEPT;
+
+    // Silence 4251 on Windows since private member variables do not
+    // need to be exported from a DLL.
+#pragma warning(push)
+#pragma warning(disable: 4251)
+    JSString property_name__;
+    std::unordered_map<std::intptr_t, JSObjectRef> sentinels__;
+#pragma warning(pop)
+  };
+
+}} // namespace HAL { namespace detail {
+
+#endif // _HAL_DETAIL_JSWEAKMAPBASE_HPP_
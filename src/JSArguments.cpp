@@ -0,0 +1,21 @@
+/**
+ * HAL
+ *
+ * Copyright (c) 2014 by Appcelerator, Inc. All Rights Reserved.
+ * Licensed under the terms of the Apache Public License.
+ * Please see the LICENSE included with this distribution for details.
+ */
+
+#include "HAL/JSArguments.hpp"
+
+#include "HAL/JSValue.hpp"
+
+#include "HAL/detail/JSUtil.hpp"
+
+namespace HAL {
+  
+  JSArguments::operator std::vector<JSValue>() const {
+    return detail::to_vector(get_context(), argument_count__, arguments_array__);
+  }
+  
+} // namespace HAL {
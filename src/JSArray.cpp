@@ -45,24 +45,156 @@ JSObjectRef JSArray::MakeArray(const JSContext& js_context, const std::vector<JS
 	return js_object_ref;
 }
 
+JSObjectRef JSArray::MakeArray(const JSContext& js_context, const std::vector<JSValueRef>& js_value_refs, bool unprotect) {
+	JSValueRef exception { nullptr };
+	JSObjectRef js_object_ref = JSObjectMakeArray(static_cast<JSContextRef>(js_context), js_value_refs.size(), js_value_refs.empty() ? nullptr : &js_value_refs[0], &exception);
+
+	// The Array, which is on the stack, now keeps the elements alive.
+	if (unprotect) {
+		UnprotectElements(js_context, js_value_refs);
+	}
+
+	if (exception) {
+		// If this assert fails then we need to JSValueUnprotect
+		// js_object_ref.
+		assert(!js_object_ref);
+		detail::ThrowRuntimeError("JSArray", JSValue(js_context, exception));
+	}
+
+	return js_object_ref;
+}
+
+JSValueRef JSArray::MakeElement(const JSContext& js_context, double value) HAL_NOEXCEPT {
+	return JSValueMakeNumber(static_cast<JSContextRef>(js_context), value);
+}
+
+JSValueRef JSArray::MakeElement(const JSContext& js_context, bool value) HAL_NOEXCEPT {
+	return JSValueMakeBoolean(static_cast<JSContextRef>(js_context), value);
+}
+
+JSValueRef JSArray::MakeElement(const JSContext& js_context, const char* value) HAL_NOEXCEPT {
+	JSStringRef js_string_ref = JSStringCreateWithUTF8CString(value);
+	JSValueRef js_value_ref = JSValueMakeString(static_cast<JSContextRef>(js_context), js_string_ref);
+	JSStringRelease(js_string_ref);
+	JSValueProtect(static_cast<JSContextRef>(js_context), js_value_ref);
+	return js_value_ref;
+}
+
+JSValueRef JSArray::MakeElement(const JSContext& js_context, const std::string& value) HAL_NOEXCEPT {
+	return MakeElement(js_context, value.c_str());
+}
+
+JSValueRef JSArray::MakeElement(const JSContext& js_context, const JSString& value) HAL_NOEXCEPT {
+	JSValueRef js_value_ref = JSValueMakeString(static_cast<JSContextRef>(js_context), static_cast<JSStringRef>(value));
+	JSValueProtect(static_cast<JSContextRef>(js_context), js_value_ref);
+	return js_value_ref;
+}
+
+JSValueRef JSArray::MakeElement(const JSContext& js_context, const JSValue& value) HAL_NOEXCEPT {
+	JSValueRef js_value_ref = static_cast<JSValueRef>(value);
+	JSValueProtect(static_cast<JSContextRef>(js_context), js_value_ref);
+	return js_value_ref;
+}
+
+JSValueRef JSArray::MakeElement(const JSContext& js_context, const JSObject& value) HAL_NOEXCEPT {
+	JSValueRef js_value_ref = static_cast<JSObjectRef>(value);
+	JSValueProtect(static_cast<JSContextRef>(js_context), js_value_ref);
+	return js_value_ref;
+}
+
+JSValueRef JSArray::MakeElement(const JSContext& js_context, const JSValueView& value) HAL_NOEXCEPT {
+	JSValueRef js_value_ref = static_cast<JSValueRef>(value);
+	JSValueProtect(static_cast<JSContextRef>(js_context), js_value_ref);
+	return js_value_ref;
+}
+
+void JSArray::UnprotectElements(const JSContext& js_context, const std::vector<JSValueRef>& js_value_refs) HAL_NOEXCEPT {
+	for (const auto js_value_ref : js_value_refs) {
+		JSValueUnprotect(static_cast<JSContextRef>(js_context), js_value_ref);
+	}
+}
+
+void JSArray::AppendElements(const std::vector<JSValueRef>& js_value_refs, bool unprotect) {
+	const auto js_context = get_context();
+	const auto js_context_ref = static_cast<JSContextRef>(js_context);
+	const auto js_object_ref = static_cast<JSObjectRef>(*this);
+	const auto length = GetLength();
+
+	JSValueRef exception { nullptr };
+	for (std::size_t i = 0; i < js_value_refs.size() && !exception; ++i) {
+		JSObjectSetPropertyAtIndex(js_context_ref, js_object_ref, length + static_cast<unsigned>(i), js_value_refs[i], &exception);
+	}
+
+	if (unprotect) {
+		UnprotectElements(js_context, js_value_refs);
+	}
+
+	if (exception) {
+		detail::ThrowRuntimeError("JSArray", JSValue(js_context, exception));
+	}
+}
+
+void JSArray::Append(const std::vector<JSValue>& values) {
+	AppendElements(detail::to_vector(values), false);
+}
+
 uint32_t JSArray::GetLength() const HAL_NOEXCEPT {
-	if (!HasProperty("length")) {
+	// The property name is created once and deliberately never
+	// released, so that asking for the length doesn't create a
+	// JSString each time.
+	static const JSStringRef length_property_name = JSStringCreateWithUTF8CString("length");
+	const auto js_context_ref = static_cast<JSContextRef>(get_context());
+	JSValueRef js_value_ref = JSObjectGetProperty(js_context_ref, static_cast<JSObjectRef>(*this), length_property_name, nullptr);
+	if (!js_value_ref || !JSValueIsNumber(js_context_ref, js_value_ref)) {
 		return 0;
 	}
-	const auto length = GetProperty("length");
-	if (!length.IsNumber()) {
+	return static_cast<uint32_t>(JSValueToNumber(js_context_ref, js_value_ref, nullptr));
+}
+
+uint32_t JSArray::GetRange(uint32_t begin, uint32_t end, std::vector<JSValue>& values) const {
+	values.clear();
+	end = std::min(end, GetLength());
+	if (begin >= end) {
 		return 0;
 	}
-	return static_cast<uint32_t>(length);
+
+	const auto js_context = get_context();
+	const auto js_context_ref = static_cast<JSContextRef>(js_context);
+	const auto js_object_ref = static_cast<JSObjectRef>(*this);
+	values.reserve(end - begin);
+	for (uint32_t i = begin; i < end; ++i) {
+		JSValueRef exception { nullptr };
+		JSValueRef js_value_ref = JSObjectGetPropertyAtIndex(js_context_ref, js_object_ref, i, &exception);
+		if (exception) {
+			detail::ThrowRuntimeError("JSArray", JSValue(js_context, exception));
+		}
+		values.push_back(JSValue(js_context, js_value_ref));
+	}
+
+	return end - begin;
 }
 
 JSArray::operator std::vector<JSValue>() const {
 	std::vector<JSValue> items;
-	const auto length = GetLength();
-	for (uint32_t i = 0; i < length; i++) {
-		items.push_back(GetProperty(i));
-	}
+	GetRange(0, GetLength(), items);
 	return items;
 }
 
+JSArray::const_iterator JSArray::begin() const HAL_NOEXCEPT {
+	return const_iterator(this, static_cast<JSContextRef>(get_context()), 0);
+}
+
+JSArray::const_iterator JSArray::end() const HAL_NOEXCEPT {
+	return const_iterator(this, static_cast<JSContextRef>(get_context()), GetLength());
+}
+
+JSValueView JSArray::const_iterator::operator*() const {
+	JSValueRef exception { nullptr };
+	JSValueRef js_value_ref = JSObjectGetPropertyAtIndex(js_context_ref__, static_cast<JSObjectRef>(*js_array__), index__, &exception);
+	if (exception) {
+		detail::ThrowRuntimeError("JSArray", JSValue(js_array__ -> get_context(), exception));
+	}
+	return JSValueView(js_context_ref__, js_value_ref);
+}
+
 } // namespace HAL {
@@ -0,0 +1,63 @@
+/**
+ * HAL
+ *
+ * Copyright (c) 2014 by Appcelerator, Inc. All Rights Reserved.
+ * Licensed under the terms of the Apache Public License.
+ * Please see the LICENSE included with this distribution for details.
+ */
+
+#include "HAL/JSArrayBuffer.hpp"
+#include "HAL/JSValue.hpp"
+#include "HAL/detail/JSUtil.hpp"
+
+#include <cassert>
+#include <memory>
+
+namespace HAL {
+
+  JSArrayBuffer::JSArrayBuffer(const JSContext& js_context, void* bytes, std::size_t byte_length, JSBytesDeallocator deallocator)
+  : JSObject(js_context, MakeArrayBuffer(js_context, bytes, byte_length, std::move(deallocator))) {
+  }
+
+  JSArrayBuffer::JSArrayBuffer(const JSContext& js_context, JSObjectRef js_object_ref)
+  : JSObject(js_context, js_object_ref) {
+    JSValueRef exception { nullptr };
+    const auto type = JSValueGetTypedArrayType(static_cast<JSContextRef>(js_context), js_object_ref, &exception);
+    if (exception || type != kJSTypedArrayTypeArrayBuffer) {
+      detail::ThrowInvalidArgument("JSArrayBuffer", "This JavaScript object is not an ArrayBuffer.");
+    }
+  }
+
+  std::uint8_t* JSArrayBuffer::data() const HAL_NOEXCEPT {
+    return static_cast<std::uint8_t*>(JSObjectGetArrayBufferBytesPtr(static_cast<JSContextRef>(get_context()), static_cast<JSObjectRef>(*this), nullptr));
+  }
+
+  std::size_t JSArrayBuffer::size() const HAL_NOEXCEPT {
+    return JSObjectGetArrayBufferByteLength(static_cast<JSContextRef>(get_context()), static_cast<JSObjectRef>(*this), nullptr);
+  }
+
+  JSObjectRef JSArrayBuffer::MakeArrayBuffer(const JSContext& js_context, void* bytes, std::size_t byte_length, JSBytesDeallocator deallocator) {
+    std::unique_ptr<JSBytesDeallocator> deallocator_context(new JSBytesDeallocator(std::move(deallocator)));
+    JSValueRef exception { nullptr };
+    JSObjectRef js_object_ref = JSObjectMakeArrayBufferWithBytesNoCopy(static_cast<JSContextRef>(js_context), bytes, byte_length, DeallocateBytes, deallocator_context.get(), &exception);
+    if (exception) {
+      // If this assert fails then we need to JSValueUnprotect
+      // js_object_ref.
+      assert(!js_object_ref);
+      // The caller keeps ownership of bytes.
+      detail::ThrowRuntimeError("JSArrayBuffer", JSValue(js_context, exception));
+    }
+
+    // JavaScriptCore now owns the deallocator.
+    deallocator_context.release();
+    return js_object_ref;
+  }
+
+  void JSArrayBuffer::DeallocateBytes(void* bytes, void* deallocator_context) {
+    std::unique_ptr<JSBytesDeallocator> deallocator(static_cast<JSBytesDeallocator*>(deallocator_context));
+    if (deallocator && *deallocator) {
+      (*deallocator)(bytes);
+    }
+  }
+
+} // namespace HAL {
@@ -12,19 +12,116 @@
 
 #include <string>
 #include <algorithm>
+#include <unordered_map>
+#include <unordered_set>
 
 namespace HAL {
   
+  namespace {
+    
+    // The interned class names and the registered classes. The
+    // registry is never destroyed, so that the JSClassRefs it holds
+    // remain valid during static destruction.
+    struct JSClassRegistry final {
+      std::unordered_set<std::string>             names;
+      std::unordered_map<std::string, JSClassRef> js_class_refs;
+    };
+    
+    JSClassRegistry& GetRegistry() {
+      static JSClassRegistry* registry = new JSClassRegistry();
+      return *registry;
+    }
+    
+    template<typename U>
+    void AppendBytes(std::string& key, const U& value) {
+      key.append(reinterpret_cast<const char*>(&value), sizeof(value));
+    }
+    
+    void AppendName(std::string& key, const char* name) {
+      key.append(name ? name : "");
+      key.push_back('\0');
+    }
+    
+    // Return the bytes of everything in js_class_definition that
+    // JSClassCreate reads, except className, whose pointer differs
+    // between copies of the same definition.
+    std::string MakeRegistryKey(const std::string& name, const ::JSClassDefinition& js_class_definition) {
+      std::string key;
+      AppendName(key, name.c_str());
+      AppendBytes(key, js_class_definition.version);
+      AppendBytes(key, js_class_definition.attributes);
+      AppendBytes(key, js_class_definition.parentClass);
+      AppendBytes(key, js_class_definition.initialize);
+      AppendBytes(key, js_class_definition.finalize);
+      AppendBytes(key, js_class_definition.hasProperty);
+      AppendBytes(key, js_class_definition.getProperty);
+      AppendBytes(key, js_class_definition.setProperty);
+      AppendBytes(key, js_class_definition.deleteProperty);
+      AppendBytes(key, js_class_definition.getPropertyNames);
+      AppendBytes(key, js_class_definition.callAsFunction);
+      AppendBytes(key, js_class_definition.callAsConstructor);
+      AppendBytes(key, js_class_definition.hasInstance);
+      AppendBytes(key, js_class_definition.convertToType);
+      
+      for (auto static_value_ptr = js_class_definition.staticValues; static_value_ptr && static_value_ptr -> name; ++static_value_ptr) {
+        AppendName(key, static_value_ptr -> name);
+        AppendBytes(key, static_value_ptr -> getProperty);
+        AppendBytes(key, static_value_ptr -> setProperty);
+        AppendBytes(key, static_value_ptr -> attributes);
+      }
+      key.push_back('\0');
+      
+      for (auto static_function_ptr = js_class_definition.staticFunctions; static_function_ptr && static_function_ptr -> name; ++static_function_ptr) {
+        AppendName(key, static_function_ptr -> name);
+        AppendBytes(key, static_function_ptr -> callAsFunction);
+        AppendBytes(key, static_function_ptr -> attributes);
+      }
+      
+      return key;
+    }
+    
+  } // namespace {
+  
+#ifdef HAL_THREAD_SAFE
+  std::recursive_mutex JSClass::mutex_static__;
+#endif
+  
+  const std::string* JSClass::InternName(const std::string& name) {
+    HAL_JSCLASS_LOCK_GUARD_STATIC;
+    // The elements of an unordered_set never move.
+    return &*GetRegistry().names.insert(name).first;
+  }
+  
+  JSClassRef JSClass::AcquireClassRef(const std::string& name, const ::JSClassDefinition& js_class_definition) {
+    HAL_JSCLASS_LOCK_GUARD_STATIC;
+    auto& js_class_refs = GetRegistry().js_class_refs;
+    auto  key           = MakeRegistryKey(name, js_class_definition);
+    auto  position      = js_class_refs.find(key);
+    if (position == js_class_refs.end()) {
+      // The registry holds the reference returned by JSClassCreate.
+      position = js_class_refs.emplace(std::move(key), JSClassCreate(&js_class_definition)).first;
+      HAL_LOG_DEBUG("JSClass: registered ", position -> second, " for ", name);
+    }
+    
+    return JSClassRetain(position -> second);
+  }
+  
+  const JSClass& JSClass::get_empty() HAL_NOEXCEPT {
+    // Deliberately never destroyed, like the registry.
+    static const JSClass* js_class = new JSClass();
+    return *js_class;
+  }
+  
   JSClass::JSClass() HAL_NOEXCEPT
-  : name__("Empty")
-  , js_class_ref__(JSClassCreate(&kJSClassDefinitionEmpty)) {
+  : name__(InternName("Empty"))
+  , js_class_ref__(AcquireClassRef(*name__, kJSClassDefinitionEmpty)) {
     HAL_LOG_TRACE("JSClass:: ctor ", this);
-    HAL_LOG_TRACE("JSClass:: retain ", js_class_ref__, " (implicit) for ", this);
+    HAL_LOG_TRACE("JSClass:: retain ", js_class_ref__, " for ", this);
   }
   
   JSClass::JSClass(const JSClassDefinition& js_class_definition) HAL_NOEXCEPT
-  : name__(js_class_definition.name__)
-  , js_class_ref__(JSClassCreate(&js_class_definition.js_class_definition__)) {
+  : name__(InternName(js_class_definition.name__))
+  , js_class_ref__(AcquireClassRef(*name__, js_class_definition.js_class_definition__)) {
     HAL_LOG_TRACE("JSClass:: ctor ", this);
     HAL_LOG_TRACE("JSClass:: retain ", js_class_ref__, " for ", this);
   }
@@ -44,7 +141,7 @@ namespace HAL {
   }
   
   JSClass::JSClass(JSClass&& rhs) HAL_NOEXCEPT
-  : name__(std::move(rhs.name__))
+  : name__(rhs.name__)
   , js_class_ref__(rhs.js_class_ref__) {
     HAL_LOG_TRACE("JSClass:: move ctor ", this);
     HAL_LOG_TRACE("JSClass:: retain ", js_class_ref__, " for ", this);
@@ -19,35 +19,44 @@
 
 #include "HAL/JSObject.hpp"
 #include "HAL/JSArray.hpp"
+#include "HAL/JSObjectTemplate.hpp"
 #include "HAL/JSDate.hpp"
 #include "HAL/JSError.hpp"
+#include "HAL/JSArrayBuffer.hpp"
+#include "HAL/JSSharedBuffer.hpp"
+#include "HAL/JSTypedArray.hpp"
 #include "HAL/JSFunction.hpp"
 #include "HAL/JSRegExp.hpp"
+#include "HAL/JSResult.hpp"
 
+#include "HAL/detail/JSContextValueCache.hpp"
+#include "HAL/detail/JSMappedFile.hpp"
 #include "HAL/detail/JSUtil.hpp"
 
 #include <cassert>
+#include <cstdint>
+#include <limits>
+#include <sstream>
 
 namespace HAL {
   
   JSObject JSContext::get_global_object() const HAL_NOEXCEPT {
-    HAL_JSCONTEXT_LOCK_GUARD;
-    return JSObject(JSContext(js_global_context_ref__), JSContextGetGlobalObject(js_global_context_ref__));
+    return GetBuiltins().global_object;
   }
   
   JSValue JSContext::CreateValueFromJSON(const JSString& js_string) const {
     HAL_JSCONTEXT_LOCK_GUARD;
-    return JSValue(JSContext(js_global_context_ref__), js_string, true);
+    return JSValue(*this, js_string, true);
   }
   
   JSValue JSContext::CreateString() const HAL_NOEXCEPT {
     HAL_JSCONTEXT_LOCK_GUARD;
-    return JSValue(JSContext(js_global_context_ref__), JSString(), false);
+    return JSValue(*this, JSString(), false);
   }
   
   JSValue JSContext::CreateString(const JSString& js_string) const HAL_NOEXCEPT {
     HAL_JSCONTEXT_LOCK_GUARD;
-    return JSValue(JSContext(js_global_context_ref__), js_string, false);
+    return JSValue(*this, js_string, false);
   }
   
   JSValue JSContext::CreateString(const char* string) const HAL_NOEXCEPT {
@@ -59,104 +68,198 @@ namespace HAL {
   }
   
   JSUndefined JSContext::CreateUndefined() const HAL_NOEXCEPT {
-    HAL_JSCONTEXT_LOCK_GUARD;
-    return JSUndefined(JSContext(js_global_context_ref__));
+    return get_undefined();
   }
   
   JSNull JSContext::CreateNull() const HAL_NOEXCEPT {
-    HAL_JSCONTEXT_LOCK_GUARD;
-    return JSNull(JSContext(js_global_context_ref__));
+    return get_null();
   }
 	
   JSValue JSContext::CreateNativeNull() const HAL_NOEXCEPT {
-    HAL_JSCONTEXT_LOCK_GUARD;
     // Use JSNull to represent native nullptr
-    auto value = JSNull(JSContext(js_global_context_ref__));
+    JSValue value = get_null();
     value.MarkAsNativeNull();
     return value;
   }
 	
   JSBoolean JSContext::CreateBoolean(bool boolean) const HAL_NOEXCEPT {
-    HAL_JSCONTEXT_LOCK_GUARD;
-    return JSBoolean(JSContext(js_global_context_ref__), boolean);
+    return get_boolean(boolean);
   }
   
   JSNumber JSContext::CreateNumber(double number) const HAL_NOEXCEPT {
     HAL_JSCONTEXT_LOCK_GUARD;
-    return JSNumber(JSContext(js_global_context_ref__), number);
+    return JSNumber(*this, number);
   }
   
   JSNumber JSContext::CreateNumber(int32_t number) const HAL_NOEXCEPT {
     HAL_JSCONTEXT_LOCK_GUARD;
-    return JSNumber(JSContext(js_global_context_ref__), number);
+    if (IsCachedNumber(number)) {
+      return get_number(number);
+    }
+    return JSNumber(*this, number);
   }
   
   JSNumber JSContext::CreateNumber(uint32_t number) const HAL_NOEXCEPT {
     HAL_JSCONTEXT_LOCK_GUARD;
-    return JSNumber(JSContext(js_global_context_ref__), number);
+    if (number <= static_cast<uint32_t>(std::numeric_limits<int32_t>::max()) && IsCachedNumber(static_cast<int32_t>(number))) {
+      return get_number(static_cast<int32_t>(number));
+    }
+    return JSNumber(*this, number);
+  }
+  
+  const JSUndefined& JSContext::get_undefined() const HAL_NOEXCEPT {
+    return GetValueCache().js_undefined__;
+  }
+  
+  const JSNull& JSContext::get_null() const HAL_NOEXCEPT {
+    return GetValueCache().js_null__;
+  }
+  
+  const JSBoolean& JSContext::get_boolean(bool boolean) const HAL_NOEXCEPT {
+    const auto& value_cache = GetValueCache();
+    return boolean ? value_cache.js_true__ : value_cache.js_false__;
+  }
+  
+  const JSNumber& JSContext::get_number(std::int32_t number) const {
+    const auto& value_cache = GetValueCacheWithNumbers();
+    if (!IsCachedNumber(number)) {
+      std::ostringstream os;
+      os << "Number " << number << " is not a cached number.";
+      detail::ThrowInvalidArgument("JSContext", os.str());
+    }
+    return value_cache.js_numbers__.at(static_cast<std::size_t>(static_cast<std::int64_t>(number) - value_cache.first_number__));
+  }
+  
+  bool JSContext::IsCachedNumber(std::int32_t number) const HAL_NOEXCEPT {
+    HAL_JSCONTEXT_LOCK_GUARD_STATIC;
+    const auto value_cache = js_context_data__ -> value_cache__;
+    if (value_cache && !value_cache -> js_numbers__.empty()) {
+      const auto first = static_cast<std::int64_t>(value_cache -> first_number__);
+      return number >= first && number < first + static_cast<std::int64_t>(value_cache -> js_numbers__.size());
+    }
+    return number >= cached_number_first__ && number <= cached_number_last__;
+  }
+  
+  std::int32_t JSContext::cached_number_first__ = -1;
+  std::int32_t JSContext::cached_number_last__  = 255;
+  
+  void JSContext::SetCachedNumberRange(std::int32_t first, std::int32_t last) HAL_NOEXCEPT {
+    HAL_JSCONTEXT_LOCK_GUARD_STATIC;
+    cached_number_first__ = first;
+    cached_number_last__  = last;
   }
   
   JSObject JSContext::CreateObject() const HAL_NOEXCEPT {
-    return CreateObject(JSClass());
+    return CreateObject(JSClass::get_empty());
   }
   
   JSObject JSContext::CreateObject(const JSClass& js_class) const HAL_NOEXCEPT {
     HAL_JSCONTEXT_LOCK_GUARD;
-    return JSObject(JSContext(js_global_context_ref__), js_class);
+    return JSObject(*this, js_class);
   }
 
   JSObject JSContext::CreateObject(const std::unordered_map<std::string, JSValue>& properties) const HAL_NOEXCEPT {
-    return CreateObject(JSClass(), properties);
+    return CreateObject(JSClass::get_empty(), properties);
   }
 
   JSObject JSContext::CreateObject(const JSClass& js_class, const std::unordered_map<std::string, JSValue>& properties) const HAL_NOEXCEPT {
     HAL_JSCONTEXT_LOCK_GUARD;
-    auto object = CreateObject();
-    for (const auto kv : properties) {
-      object.SetProperty(kv.first, kv.second);
+    auto js_object = CreateObject(js_class);
+    const auto js_context_ref = static_cast<JSContextRef>(*this);
+    const auto js_object_ref  = static_cast<JSObjectRef>(js_object);
+    for (const auto& property : properties) {
+      // Only the JSStringRef is needed, so don't create a JSString.
+      JSStringRef property_name_ref = JSStringCreateWithUTF8CString(property.first.c_str());
+      JSObjectSetProperty(js_context_ref, js_object_ref, property_name_ref, static_cast<JSValueRef>(property.second), kJSPropertyAttributeNone, nullptr);
+      JSStringRelease(property_name_ref);
     }
-    return object;
+    return js_object;
   }
 
   
   JSArray JSContext::CreateArray() const HAL_NOEXCEPT {
     HAL_JSCONTEXT_LOCK_GUARD;
-    return JSArray(JSContext(js_global_context_ref__));
+    return JSArray(*this);
   }
   
   JSArray JSContext::CreateArray(const std::vector<JSValue>& arguments) const {
     HAL_JSCONTEXT_LOCK_GUARD;
-    return JSArray(JSContext(js_global_context_ref__), arguments);
+    return JSArray(*this, arguments);
+  }
+  
+  JSObjectTemplate JSContext::CreateObjectTemplate(const std::vector<JSString>& property_names) const {
+    HAL_JSCONTEXT_LOCK_GUARD;
+    return JSObjectTemplate(*this, property_names);
+  }
+  
+  JSArrayBuffer JSContext::CreateArrayBuffer(std::size_t byte_length) const {
+    HAL_JSCONTEXT_LOCK_GUARD;
+    return CreateTypedArray<std::uint8_t>(byte_length).GetBuffer();
+  }
+  
+  JSArrayBuffer JSContext::CreateArrayBuffer(void* bytes, std::size_t byte_length, JSBytesDeallocator deallocator) const {
+    HAL_JSCONTEXT_LOCK_GUARD;
+    return JSArrayBuffer(*this, bytes, byte_length, std::move(deallocator));
+  }
+  
+  JSArrayBuffer JSContext::CreateArrayBuffer(const JSSharedBuffer& js_shared_buffer) const {
+    HAL_JSCONTEXT_LOCK_GUARD;
+    if (js_shared_buffer.empty()) {
+      return CreateArrayBuffer(0);
+    }
+    
+    // The deallocator keeps a reference to the shared memory alive
+    // until the ArrayBuffer is garbage collected.
+    const auto bytes = js_shared_buffer.bytes__;
+    return JSArrayBuffer(*this, const_cast<std::uint8_t*>(bytes.get()), js_shared_buffer.size(), [bytes](void*) {});
+  }
+  
+  JSArrayBuffer JSContext::CreateArrayBufferFromFile(const std::string& path) const {
+    HAL_JSCONTEXT_LOCK_GUARD;
+    std::size_t byte_length = 0;
+    void* bytes = detail::MapFile(path, byte_length);
+    if (!bytes) {
+      return CreateArrayBuffer(0);
+    }
+    
+    try {
+      return JSArrayBuffer(*this, bytes, byte_length, [byte_length](void* bytes) {
+        detail::UnmapFile(bytes, byte_length);
+      });
+    } catch (...) {
+      detail::UnmapFile(bytes, byte_length);
+      throw;
+    }
   }
   
   JSDate JSContext::CreateDate() const HAL_NOEXCEPT {
     HAL_JSCONTEXT_LOCK_GUARD;
-    return JSDate(JSContext(js_global_context_ref__));
+    return JSDate(*this);
   }
   
   JSDate JSContext::CreateDate(const std::vector<JSValue>& arguments) const {
     HAL_JSCONTEXT_LOCK_GUARD;
-    return JSDate(JSContext(js_global_context_ref__), arguments);
+    return JSDate(*this, arguments);
   }
   
   JSError JSContext::CreateError() const HAL_NOEXCEPT {
     HAL_JSCONTEXT_LOCK_GUARD;
-    return JSError(JSContext(js_global_context_ref__));
+    return JSError(*this);
   }
   
   JSError JSContext::CreateError(const std::vector<JSValue>& arguments) const {
     HAL_JSCONTEXT_LOCK_GUARD;
-    return JSError(JSContext(js_global_context_ref__), arguments);
+    return JSError(*this, arguments);
   }
   
   JSRegExp JSContext::CreateRegExp() const HAL_NOEXCEPT {
     HAL_JSCONTEXT_LOCK_GUARD;
-    return JSRegExp(JSContext(js_global_context_ref__));
+    return JSRegExp(*this);
   }
   
   JSRegExp JSContext::CreateRegExp(const std::vector<JSValue>& arguments) const {
     HAL_JSCONTEXT_LOCK_GUARD;
-    return JSRegExp(JSContext(js_global_context_ref__), arguments);
+    return JSRegExp(*this, arguments);
   }
   
   JSFunction JSContext::CreateFunction(const JSString& body) const {
@@ -173,7 +276,7 @@ namespace HAL {
   
   JSFunction JSContext::CreateFunction(const JSString& body, const std::vector<JSString>& parameter_names, const JSString& function_name, const JSString& source_url, int starting_line_number) const {
     HAL_JSCONTEXT_LOCK_GUARD;
-    return JSFunction(JSContext(js_global_context_ref__), body, parameter_names, function_name, source_url, starting_line_number);
+    return JSFunction(*this, body, parameter_names, function_name, source_url, starting_line_number);
   }
   
   JSValue JSContext::JSEvaluateScript(const JSString& script) const {
@@ -194,16 +297,49 @@ namespace HAL {
     JSValueRef js_value_ref { nullptr };
     const JSStringRef source_url_ref = (source_url.length() > 0) ? static_cast<JSStringRef>(source_url) : nullptr;
     JSValueRef exception { nullptr };
-    js_value_ref = ::JSEvaluateScript(js_global_context_ref__, static_cast<JSStringRef>(script), static_cast<JSObjectRef>(this_object), source_url_ref, starting_line_number, &exception);
+    js_value_ref = ::JSEvaluateScript(js_context_data__ -> get_global_context_ref(), static_cast<JSStringRef>(script), static_cast<JSObjectRef>(this_object), source_url_ref, starting_line_number, &exception);
+    
+    if (exception) {
+      // If this assert fails then we need to JSValueUnprotect
+      // js_value_ref.
+      assert(!js_value_ref);
+      detail::ThrowRuntimeError("JSContext", JSValue(*this, exception), source_url, starting_line_number);
+    }
+    
+    return JSValue(*this, js_value_ref);
+  }
+  
+  JSResult<JSValue> JSContext::TryJSEvaluateScript(const JSString& script) const HAL_NOEXCEPT {
+    HAL_JSCONTEXT_LOCK_GUARD;
+    JSValueRef exception { nullptr };
+    // A NULL this object is the global object, without the cost of
+    // get_global_object().
+    JSValueRef js_value_ref = ::JSEvaluateScript(js_context_data__ -> get_global_context_ref(), static_cast<JSStringRef>(script), nullptr, nullptr, 1, &exception);
+    
+    if (exception) {
+      // If this assert fails then we need to JSValueUnprotect
+      // js_value_ref.
+      assert(!js_value_ref);
+      return JSException("JSContext", JSValue(*this, exception));
+    }
+    
+    return JSValue(*this, js_value_ref);
+  }
+  
+  JSResult<JSValue> JSContext::TryJSEvaluateScript(const JSString& script, JSObject this_object, const JSString& source_url, int starting_line_number) const HAL_NOEXCEPT {
+    HAL_JSCONTEXT_LOCK_GUARD;
+    const JSStringRef source_url_ref = (source_url.length() > 0) ? static_cast<JSStringRef>(source_url) : nullptr;
+    JSValueRef exception { nullptr };
+    JSValueRef js_value_ref = ::JSEvaluateScript(js_context_data__ -> get_global_context_ref(), static_cast<JSStringRef>(script), static_cast<JSObjectRef>(this_object), source_url_ref, starting_line_number, &exception);
     
     if (exception) {
       // If this assert fails then we need to JSValueUnprotect
       // js_value_ref.
       assert(!js_value_ref);
-      detail::ThrowRuntimeError("JSContext", JSValue(JSContext(js_global_context_ref__), exception), source_url, starting_line_number);
+      return JSException("JSContext", JSValue(*this, exception), source_url, starting_line_number);
     }
     
-    return JSValue(JSContext(js_global_context_ref__), js_value_ref);
+    return JSValue(*this, js_value_ref);
   }
   
   bool JSContext::JSCheckScriptSyntax(const JSString& script) const HAL_NOEXCEPT {
@@ -214,10 +350,10 @@ namespace HAL {
     HAL_JSCONTEXT_LOCK_GUARD;
     const JSStringRef source_url_ref = (source_url.length() > 0) ? static_cast<JSStringRef>(source_url) : nullptr;
     JSValueRef exception { nullptr };
-    bool result = ::JSCheckScriptSyntax(js_global_context_ref__, static_cast<JSStringRef>(script), source_url_ref, starting_line_number, &exception);
+    bool result = ::JSCheckScriptSyntax(js_context_data__ -> get_global_context_ref(), static_cast<JSStringRef>(script), source_url_ref, starting_line_number, &exception);
     
     if (exception) {
-      detail::ThrowRuntimeError("JSContext", JSValue(JSContext(js_global_context_ref__), exception));
+      detail::ThrowRuntimeError("JSContext", JSValue(*this, exception));
     }
     
     return result;
@@ -225,7 +361,7 @@ namespace HAL {
   
   void JSContext::GarbageCollect() const HAL_NOEXCEPT {
     HAL_JSCONTEXT_LOCK_GUARD;
-    JSGarbageCollect(js_global_context_ref__);
+    JSGarbageCollect(js_context_data__ -> get_global_context_ref());
   }
   
 #ifdef DEBUG
@@ -234,35 +370,38 @@ namespace HAL {
   
   void JSContext::SynchronousGarbageCollectForDebugging() const {
     HAL_JSCONTEXT_LOCK_GUARD;
-    JSSynchronousGarbageCollectForDebugging(js_global_context_ref__);
+    JSSynchronousGarbageCollectForDebugging(js_context_data__ -> get_global_context_ref());
   }
 
   void JSContext::SynchronousEdenCollectForDebugging() const {
     HAL_JSCONTEXT_LOCK_GUARD;
-    JSSynchronousEdenCollectForDebugging(js_global_context_ref__);
+    JSSynchronousEdenCollectForDebugging(js_context_data__ -> get_global_context_ref());
   }
 #endif
   
   JSContext::~JSContext() HAL_NOEXCEPT {
     HAL_LOG_TRACE("JSContext:: dtor ", this);
-    HAL_LOG_TRACE("JSContext:: release ", js_global_context_ref__, " for ", this);
-    JSGlobalContextRelease(js_global_context_ref__);
+    if (borrowed__) {
+      return;
+    }
+    HAL_LOG_TRACE("JSContext:: release ", js_context_data__ -> get_global_context_ref(), " for ", this);
+    ReleaseContextData(js_context_data__);
   }
   
   JSContext::JSContext(const JSContext& rhs) HAL_NOEXCEPT
   : js_context_group__(rhs.js_context_group__)
-  , js_global_context_ref__(rhs.js_global_context_ref__) {
+  , js_context_data__(rhs.js_context_data__) {
     HAL_LOG_TRACE("JSContext:: copy ctor ", this);
-    HAL_LOG_TRACE("JSContext:: retain ", js_global_context_ref__, " for ", this);
-    JSGlobalContextRetain(js_global_context_ref__);
+    HAL_LOG_TRACE("JSContext:: retain ", js_context_data__ -> get_global_context_ref(), " for ", this);
+    RetainContextData(js_context_data__);
   }
   
   JSContext::JSContext(JSContext&& rhs) HAL_NOEXCEPT
   : js_context_group__(std::move(rhs.js_context_group__))
-  , js_global_context_ref__(rhs.js_global_context_ref__) {
+  , js_context_data__(rhs.js_context_data__) {
     HAL_LOG_TRACE("JSContext:: move ctor ", this);
-    HAL_LOG_TRACE("JSContext:: retain ", js_global_context_ref__, " for ", this);
-    JSGlobalContextRetain(js_global_context_ref__);
+    HAL_LOG_TRACE("JSContext:: retain ", js_context_data__ -> get_global_context_ref(), " for ", this);
+    RetainContextData(js_context_data__);
   }
   
   JSContext& JSContext::operator=(JSContext rhs) HAL_NOEXCEPT {
@@ -279,15 +418,20 @@ namespace HAL {
     
     // By swapping the members of two classes, the two classes are
     // effectively swapped.
-    swap(js_context_group__     , other.js_context_group__);
-    swap(js_global_context_ref__, other.js_global_context_ref__);
+    swap(js_context_group__, other.js_context_group__);
+    swap(js_context_data__ , other.js_context_data__);
+    swap(borrowed__        , other.borrowed__);
   }
   
   JSContext::JSContext(const JSContextGroup& js_context_group, const JSClass& global_object_class) HAL_NOEXCEPT
-  : js_context_group__(js_context_group)
-  , js_global_context_ref__(JSGlobalContextCreateInGroup(static_cast<JSContextGroupRef>(js_context_group), static_cast<JSClassRef>(global_object_class))) {
+  : js_context_group__(js_context_group) {
     HAL_LOG_TRACE("JSContext:: ctor 1 ", this);
-    HAL_LOG_TRACE("JSContext:: retain ", js_global_context_ref__, " (implicit) for ", this);
+    JSGlobalContextRef js_global_context_ref = JSGlobalContextCreateInGroup(static_cast<JSContextGroupRef>(js_context_group), static_cast<JSClassRef>(global_object_class));
+    js_context_data__ = AcquireContextData(js_global_context_ref);
+    
+    // The JSContextData holds its own retain, so give up the one
+    // implied by JSGlobalContextCreateInGroup.
+    JSGlobalContextRelease(js_global_context_ref);
   }
   
   JSContext::JSContext(JSContextRef js_context_ref) HAL_NOEXCEPT
@@ -297,11 +441,149 @@ namespace HAL {
   // For interoperability with the JavaScriptCore C API.
   JSContext::JSContext(JSGlobalContextRef js_global_context_ref) HAL_NOEXCEPT
   : js_context_group__(JSContextGetGroup(js_global_context_ref))
-  , js_global_context_ref__(js_global_context_ref) {
+  , js_context_data__(AcquireContextData(js_global_context_ref)) {
     HAL_LOG_TRACE("JSContext:: ctor 2 ", this);
-    assert(js_global_context_ref__);
-    HAL_LOG_TRACE("JSContext:: retain ", js_global_context_ref__, " for ", this);
-    JSGlobalContextRetain(js_global_context_ref__);
+    HAL_LOG_TRACE("JSContext:: retain ", js_global_context_ref, " for ", this);
+  }
+  
+  JSContext::JSContext(JSContextRef js_context_ref, BorrowedTag) HAL_NOEXCEPT
+  : js_context_group__(JSContextGetGroup(js_context_ref), JSContextGroup::BorrowedTag())
+  , borrowed__(true) {
+    HAL_LOG_TRACE("JSContext:: ctor 3 (borrowed) ", this);
+    const auto js_global_context_ref = JSContextGetGlobalContext(js_context_ref);
+    js_context_data__ = FindContextData(js_global_context_ref);
+    if (!js_context_data__) {
+      // No JSContext refers to this execution context yet, so this
+      // one has to own its JSContextData.
+      js_context_data__   = AcquireContextData(js_global_context_ref);
+      js_context_group__  = JSContextGroup(JSContextGetGroup(js_context_ref));
+      borrowed__          = false;
+    }
+  }
+  
+  JSContext::JSContext(const JSContext& js_context, BorrowedTag) HAL_NOEXCEPT
+  : js_context_group__(static_cast<JSContextGroupRef>(js_context.js_context_group__), JSContextGroup::BorrowedTag())
+  , js_context_data__(js_context.js_context_data__)
+  , borrowed__(true) {
+    HAL_LOG_TRACE("JSContext:: ctor 4 (borrowed) ", this);
+  }
+  
+  std::unordered_map<std::intptr_t, detail::JSContextData*> JSContext::js_global_context_ref_to_context_data_map__;
+#ifdef HAL_THREAD_SAFE
+  std::recursive_mutex JSContext::mutex_static__;
+#endif
+  
+  detail::JSContextData* JSContext::AcquireContextData(JSGlobalContextRef js_global_context_ref) HAL_NOEXCEPT {
+    HAL_JSCONTEXT_LOCK_GUARD_STATIC;
+    assert(js_global_context_ref);
+    const auto key      = reinterpret_cast<std::intptr_t>(js_global_context_ref);
+    const auto position = js_global_context_ref_to_context_data_map__.find(key);
+    const bool found    = position != js_global_context_ref_to_context_data_map__.end();
+    
+    detail::JSContextData* js_context_data = nullptr;
+    if (found) {
+      js_context_data = position -> second;
+    } else {
+      js_context_data = new detail::JSContextData(js_global_context_ref);
+      JSGlobalContextRetain(js_global_context_ref);
+      js_global_context_ref_to_context_data_map__.emplace(key, js_context_data);
+      HAL_LOG_DEBUG("JSContext::AcquireContextData: JSGlobalContextRef = ", js_global_context_ref);
+    }
+    
+    ++js_context_data -> reference_count__;
+    return js_context_data;
+  }
+  
+  detail::JSContextData* JSContext::FindContextData(JSGlobalContextRef js_global_context_ref) HAL_NOEXCEPT {
+    HAL_JSCONTEXT_LOCK_GUARD_STATIC;
+    const auto position = js_global_context_ref_to_context_data_map__.find(reinterpret_cast<std::intptr_t>(js_global_context_ref));
+    return position != js_global_context_ref_to_context_data_map__.end() ? position -> second : nullptr;
+  }
+  
+  void JSContext::RetainContextData(detail::JSContextData* js_context_data) HAL_NOEXCEPT {
+    HAL_JSCONTEXT_LOCK_GUARD_STATIC;
+    ++js_context_data -> reference_count__;
+  }
+  
+  void JSContext::ReleaseContextData(detail::JSContextData* js_context_data) HAL_NOEXCEPT {
+    HAL_JSCONTEXT_LOCK_GUARD_STATIC;
+    assert(js_context_data -> reference_count__ > 0);
+    --js_context_data -> reference_count__;
+    
+    if (js_context_data -> reference_count__ == 0) {
+      const auto js_global_context_ref = js_context_data -> get_global_context_ref();
+      HAL_LOG_DEBUG("JSContext::ReleaseContextData: JSGlobalContextRef = ", js_global_context_ref);
+      js_global_context_ref_to_context_data_map__.erase(reinterpret_cast<std::intptr_t>(js_global_context_ref));
+      delete js_context_data;
+      JSGlobalContextRelease(js_global_context_ref);
+    } else if (js_context_data -> value_cache__ && js_context_data -> reference_count__ == js_context_data -> cached_reference_count__) {
+      // Only the cached values refer to this execution context any
+      // more. Destroying them releases their JSContexts, the last of
+      // which reenters this function and deletes js_context_data.
+      auto value_cache = js_context_data -> value_cache__;
+      js_context_data -> value_cache__            = nullptr;
+      js_context_data -> cached_reference_count__ = 0;
+      delete value_cache;
+    }
+  }
+  
+  detail::JSContextValueCache& JSContext::GetValueCache() const HAL_NOEXCEPT {
+    HAL_JSCONTEXT_LOCK_GUARD_STATIC;
+    if (!js_context_data__ -> value_cache__) {
+      const auto reference_count = js_context_data__ -> reference_count__;
+      auto value_cache = new detail::JSContextValueCache(JSUndefined(*this), JSNull(*this), JSBoolean(*this, false), JSBoolean(*this, true));
+      js_context_data__ -> value_cache__             = value_cache;
+      js_context_data__ -> cached_reference_count__ += js_context_data__ -> reference_count__ - reference_count;
+    }
+    return *js_context_data__ -> value_cache__;
+  }
+  
+  detail::JSContextValueCache& JSContext::GetValueCacheWithNumbers() const HAL_NOEXCEPT {
+    HAL_JSCONTEXT_LOCK_GUARD_STATIC;
+    auto& value_cache = GetValueCache();
+    if (value_cache.js_numbers__.empty() && cached_number_first__ <= cached_number_last__) {
+      const auto reference_count = js_context_data__ -> reference_count__;
+      const auto count = static_cast<std::size_t>(static_cast<std::int64_t>(cached_number_last__) - cached_number_first__ + 1);
+      value_cache.first_number__ = cached_number_first__;
+      value_cache.js_numbers__.reserve(count);
+      for (std::size_t i = 0; i < count; ++i) {
+        value_cache.js_numbers__.push_back(JSNumber(*this, static_cast<std::int32_t>(cached_number_first__ + static_cast<std::int64_t>(i))));
+      }
+      js_context_data__ -> cached_reference_count__ += js_context_data__ -> reference_count__ - reference_count;
+    }
+    return value_cache;
+  }
+  
+  const detail::JSContextBuiltins& JSContext::GetBuiltins() const HAL_NOEXCEPT {
+    HAL_JSCONTEXT_LOCK_GUARD_STATIC;
+    auto& value_cache = GetValueCache();
+    if (!value_cache.js_builtins__) {
+      const auto reference_count = js_context_data__ -> reference_count__;
+      {
+        const JSObject global_object(*this, JSContextGetGlobalObject(js_context_data__ -> get_global_context_ref()));
+        const JSValue  undefined = get_undefined();
+        
+        // A script may have replaced or removed these builtins before
+        // they were first needed, and their getters may throw.
+        auto error_constructor = global_object.TryGetProperty("Error").value_or(undefined);
+        if (!error_constructor.IsObject()) {
+          error_constructor = undefined;
+        }
+        
+        JSValue array_is_array = undefined;
+        const auto array_constructor = global_object.TryGetProperty("Array").value_or(undefined);
+        if (array_constructor.IsObject()) {
+          array_is_array = static_cast<JSObject>(array_constructor).TryGetProperty("isArray").value_or(undefined);
+          if (!array_is_array.IsObject() || !static_cast<JSObject>(array_is_array).IsFunction()) {
+            array_is_array = undefined;
+          }
+        }
+        
+        value_cache.js_builtins__.reset(new detail::JSContextBuiltins(global_object, error_constructor, array_is_array));
+      }
+      js_context_data__ -> cached_reference_count__ += js_context_data__ -> reference_count__ - reference_count;
+    }
+    return *value_cache.js_builtins__;
   }
   
 } // namespace HAL {
@@ -21,7 +21,7 @@ namespace HAL {
   }
   
   JSContext JSContextGroup::CreateContext() const HAL_NOEXCEPT {
-    return JSContext(*this, JSClass());
+    return JSContext(*this, JSClass::get_empty());
   }
   
   JSContext JSContextGroup::CreateContext(const JSClass& global_object_class) const HAL_NOEXCEPT {
@@ -36,8 +36,18 @@ namespace HAL {
     JSContextGroupRetain(js_context_group_ref__);
   }
   
+  JSContextGroup::JSContextGroup(JSContextGroupRef js_context_group_ref, BorrowedTag) HAL_NOEXCEPT
+  : js_context_group_ref__(js_context_group_ref)
+  , borrowed__(true) {
+    HAL_LOG_TRACE("JSContextGroup:: ctor 3 (borrowed) ", this);
+    assert(js_context_group_ref__);
+  }
+  
   JSContextGroup::~JSContextGroup() HAL_NOEXCEPT {
     HAL_LOG_TRACE("JSContextGroup:: dtor ", this);
+    if (borrowed__) {
+      return;
+    }
     HAL_LOG_TRACE("JSContextGroup:: release ", js_context_group_ref__, " for ", this);
     JSContextGroupRelease(js_context_group_ref__);
   }
@@ -71,6 +81,7 @@ namespace HAL {
     // By swapping the members of two classes, the two classes are
     // effectively swapped.
     swap(js_context_group_ref__, other.js_context_group_ref__);
+    swap(borrowed__            , other.borrowed__);
   }
   
 } // namespace HAL {
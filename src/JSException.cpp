@@ -0,0 +1,49 @@
+/**
+ * HAL
+ *
+ * Copyright (c) 2014 by Appcelerator, Inc. All Rights Reserved.
+ * Licensed under the terms of the Apache Public License.
+ * Please see the LICENSE included with this distribution for details.
+ */
+
+#include "HAL/JSException.hpp"
+#include "HAL/JSUndefined.hpp"
+
+#include "HAL/detail/JSUtil.hpp"
+
+namespace HAL {
+
+  JSException::JSException(const char* internal_component_name, const JSValue& js_value, const std::string& source_url, int line_number) HAL_NOEXCEPT
+  : internal_component_name__(internal_component_name)
+  , js_value__(js_value)
+  , source_url__(source_url)
+  , line_number__(line_number) {
+  }
+
+  JSException::JSException(const char* internal_component_name, const JSContext& js_context, const char* native_message) HAL_NOEXCEPT
+  : internal_component_name__(internal_component_name)
+  , js_value__(js_context.get_undefined())
+  , native_message__(native_message) {
+  }
+
+  std::string JSException::message() const HAL_NOEXCEPT {
+    if (native_message__) {
+      return native_message__;
+    }
+
+    try {
+      return static_cast<std::string>(js_value__);
+    } catch (...) {
+      return "Unknown JavaScript exception";
+    }
+  }
+
+  void JSException::Throw() const {
+    if (native_message__) {
+      detail::ThrowRuntimeError(internal_component_name__, native_message__);
+    }
+
+    detail::ThrowRuntimeError(internal_component_name__, js_value__, source_url__, line_number__);
+  }
+
+} // namespace HAL {
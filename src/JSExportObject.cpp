@@ -8,6 +8,7 @@
 
 #include "HAL/JSExportObject.hpp"
 #include "HAL/JSUndefined.hpp"
+#include "HAL/detail/JSExportSlabPool.hpp"
 #include <utility>
 
 namespace HAL {
@@ -24,6 +25,10 @@ namespace HAL {
   void JSExportObject::postCallAsConstructor(const JSContext& js_context, const std::vector<JSValue>& arguments) {
     HAL_LOG_DEBUG("JSExportObject:: postCallAsConstructor ", this);
   }
+  
+  void JSExportObject::postCallAsConstructor(const JSContext& js_context, const JSArguments& arguments) {
+    postCallAsConstructor(js_context, static_cast<std::vector<JSValue>>(arguments));
+  }
 	
   JSContext JSExportObject::get_context() const HAL_NOEXCEPT {
     return js_context__;
@@ -52,3 +57,16 @@ namespace HAL {
   }
   
 } // namespace HAL {
+
+namespace HAL { namespace detail {
+  
+  void DestroyReplacedNativeObject(void* native_object_ptr) HAL_NOEXCEPT {
+    // The private data is the address of the complete native object,
+    // which is also the address of its JSExportObject base.
+    static_cast<JSExportObject*>(native_object_ptr) -> ~JSExportObject();
+    if (!JSExportSlabPool::DeallocateIfPooled(native_object_ptr)) {
+      ::operator delete(native_object_ptr);
+    }
+  }
+  
+}} // namespace HAL { namespace detail {
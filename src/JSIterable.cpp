@@ -0,0 +1,119 @@
+/**
+ * HAL
+ *
+ * Copyright (c) 2014 by Appcelerator, Inc. All Rights Reserved.
+ * Licensed under the terms of the Apache Public License.
+ * Please see the LICENSE included with this distribution for details.
+ */
+
+#include "HAL/JSIterable.hpp"
+#include "HAL/JSExport.hpp"
+#include "HAL/JSExportObject.hpp"
+#include "HAL/JSFunction.hpp"
+#include "HAL/detail/JSContextValueCache.hpp"
+#include "HAL/detail/JSUtil.hpp"
+
+#include <functional>
+#include <vector>
+
+namespace HAL {
+
+  namespace {
+
+    // The native half of an iterable created by
+    // JSContext::CreateIterable. Calling it as a function returns the
+    // next chunk of elements.
+    class JSIterableSource final : public JSExportObject, public JSExport<JSIterableSource> {
+
+    public:
+
+      JSIterableSource(const JSContext& js_context) HAL_NOEXCEPT
+      : JSExportObject(js_context) {
+      }
+
+      static void JSExportInitialize() {
+        JSExport<JSIterableSource>::SetClassVersion(1);
+        JSExport<JSIterableSource>::AddCallAsFunctionCallback(std::mem_fn(&JSIterableSource::NextChunk));
+      }
+
+      void Reset(JSIterableCallback callback, std::size_t chunk_size) {
+        callback__   = std::move(callback);
+        chunk_size__ = chunk_size;
+      }
+
+    private:
+
+      JSValue NextChunk(const std::vector<JSValue>&, JSObject&) {
+        const auto js_context = get_context();
+        if (!callback__) {
+          return js_context.CreateArray();
+        }
+
+        const auto js_array = callback__(js_context, chunk_size__);
+        if (js_array.GetLength() == 0) {
+          // Release the callback, and whatever it holds (e.g. a
+          // database cursor), as soon as the sequence ends.
+          callback__ = nullptr;
+        }
+        return js_array;
+      }
+
+      JSIterableCallback callback__;
+      std::size_t        chunk_size__ { 1 };
+    };
+
+    // The JavaScript half of an iterable. It calls source() for a new
+    // chunk only when the previous one has been consumed, and clears
+    // each element once it has been returned so that the chunk does
+    // not keep consumed elements alive.
+    const char* const kIteratorBody =
+        "var buffer = [], index = 0;\n"
+        "var iterator = {\n"
+        "  next: function () {\n"
+        "    while (index === buffer.length) {\n"
+        "      if (source === null) {\n"
+        "        return { value: undefined, done: true };\n"
+        "      }\n"
+        "      buffer = source();\n"
+        "      index  = 0;\n"
+        "      if (buffer.length === 0) {\n"
+        "        source = null;\n"
+        "      }\n"
+        "    }\n"
+        "    var value = buffer[index];\n"
+        "    buffer[index++] = undefined;\n"
+        "    return { value: value, done: false };\n"
+        "  }\n"
+        "};\n"
+        "if (typeof Symbol === 'function' && typeof Symbol.iterator === 'symbol') {\n"
+        "  iterator[Symbol.iterator] = function () { return this; };\n"
+        "}\n"
+        "return iterator;\n";
+
+  } // namespace {
+
+  JSObject JSContext::CreateIterable(JSIterableCallback callback, std::size_t chunk_size) const {
+    if (chunk_size == 0) {
+      detail::ThrowInvalidArgument("JSContext", "The chunk size of an iterable must be at least 1");
+    }
+
+    auto js_source = CreateObject(JSExport<JSIterableSource>::Class());
+    js_source.GetPrivate<JSIterableSource>() -> Reset(std::move(callback), chunk_size);
+
+    return static_cast<JSObject>(GetIteratorFactory()(std::vector<JSValue> { js_source }, get_global_object()));
+  }
+
+  JSObject& JSContext::GetIteratorFactory() const {
+    HAL_JSCONTEXT_LOCK_GUARD_STATIC;
+    auto& value_cache = GetValueCache();
+    if (!value_cache.js_iterator_factory__) {
+      const auto reference_count = js_context_data__ -> reference_count__;
+      {
+        value_cache.js_iterator_factory__.reset(new JSObject(CreateFunction(kIteratorBody, {"source"})));
+      }
+      js_context_data__ -> cached_reference_count__ += js_context_data__ -> reference_count__ - reference_count;
+    }
+    return *value_cache.js_iterator_factory__;
+  }
+
+} // namespace HAL {
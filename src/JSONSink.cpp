@@ -0,0 +1,90 @@
+/**
+ * HAL
+ *
+ * Copyright (c) 2014 by Appcelerator, Inc. All Rights Reserved.
+ * Licensed under the terms of the Apache Public License.
+ * Please see the LICENSE included with this distribution for details.
+ */
+
+#include "HAL/JSONSink.hpp"
+
+#include "HAL/detail/JSUtil.hpp"
+
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace HAL {
+
+  const std::size_t JSONSink::kChunkSize;
+
+  void JSONSink::WriteUTF16(const JSChar* characters, std::size_t length) {
+    char chunk[kChunkSize];
+    std::size_t used = 0;
+
+    for (std::size_t i = 0; i < length; ++i) {
+      // A single code point needs at most 4 bytes of UTF-8.
+      if (used + 4 > kChunkSize) {
+        Write(chunk, used);
+        used = 0;
+      }
+
+      std::uint32_t code_point = characters[i];
+      if (code_point >= 0xD800 && code_point <= 0xDBFF) {
+        if (i + 1 < length && characters[i + 1] >= 0xDC00 && characters[i + 1] <= 0xDFFF) {
+          code_point = 0x10000 + ((code_point - 0xD800) << 10) + (characters[i + 1] - 0xDC00);
+          ++i;
+        } else {
+          code_point = 0xFFFD;
+        }
+      } else if (code_point >= 0xDC00 && code_point <= 0xDFFF) {
+        code_point = 0xFFFD;
+      }
+
+      if (code_point < 0x80) {
+        chunk[used++] = static_cast<char>(code_point);
+      } else if (code_point < 0x800) {
+        chunk[used++] = static_cast<char>(0xC0 | (code_point >> 6));
+        chunk[used++] = static_cast<char>(0x80 | (code_point & 0x3F));
+      } else if (code_point < 0x10000) {
+        chunk[used++] = static_cast<char>(0xE0 | (code_point >> 12));
+        chunk[used++] = static_cast<char>(0x80 | ((code_point >> 6) & 0x3F));
+        chunk[used++] = static_cast<char>(0x80 | (code_point & 0x3F));
+      } else {
+        chunk[used++] = static_cast<char>(0xF0 | (code_point >> 18));
+        chunk[used++] = static_cast<char>(0x80 | ((code_point >> 12) & 0x3F));
+        chunk[used++] = static_cast<char>(0x80 | ((code_point >> 6) & 0x3F));
+        chunk[used++] = static_cast<char>(0x80 | (code_point & 0x3F));
+      }
+    }
+
+    if (used > 0) {
+      Write(chunk, used);
+    }
+  }
+
+  void JSONFileDescriptorSink::Write(const char* data, std::size_t length) {
+    while (length > 0) {
+#ifdef _WIN32
+      const int written = _write(file_descriptor__, data, static_cast<unsigned>(length));
+#else
+      const ssize_t written = ::write(file_descriptor__, data, length);
+#endif
+      if (written < 0) {
+        if (errno == EINTR) {
+          continue;
+        }
+        detail::ThrowRuntimeError("JSONFileDescriptorSink", std::string("Unable to write JSON to file descriptor: ") + std::strerror(errno));
+      }
+      data   += written;
+      length -= static_cast<std::size_t>(written);
+    }
+  }
+
+} // namespace HAL {
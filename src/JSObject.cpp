@@ -8,6 +8,7 @@
 
 #include "HAL/JSObject.hpp"
 #include "HAL/JSValue.hpp"
+#include "HAL/JSValueView.hpp"
 
 #include "HAL/JSClass.hpp"
 
@@ -17,7 +18,10 @@
 #include "HAL/JSNumber.hpp"
 #include "HAL/JSError.hpp"
 #include "HAL/JSArray.hpp"
+#include "HAL/JSArrayBuffer.hpp"
+#include "HAL/JSResult.hpp"
 
+#include "HAL/detail/JSContextValueCache.hpp"
 #include "HAL/detail/JSPropertyNameAccumulator.hpp"
 #include "HAL/detail/JSUtil.hpp"
 
@@ -47,6 +51,21 @@ namespace HAL {
     return JSValue(js_context__, js_value_ref);
   }
   
+  JSValue JSObject::GetProperty(const JSStringView& property_name) const {
+    HAL_JSOBJECT_LOCK_GUARD;
+    JSValueRef exception { nullptr };
+    JSValueRef js_value_ref = JSObjectGetProperty(static_cast<JSContextRef>(js_context__), js_object_ref__, static_cast<JSStringRef>(property_name), &exception);
+    if (exception) {
+      // If this assert fails then we need to JSValueUnprotect
+      // js_value_ref.
+      assert(!js_value_ref);
+      detail::ThrowRuntimeError("JSObject", JSValue(js_context__, exception));
+    }
+    
+    assert(js_value_ref);
+    return JSValue(js_context__, js_value_ref);
+  }
+  
   JSValue JSObject::GetProperty(unsigned property_index) const {
     HAL_JSOBJECT_LOCK_GUARD;
     JSValueRef exception { nullptr };
@@ -62,7 +81,7 @@ namespace HAL {
     return JSValue(js_context__, js_value_ref);
   }
   
-  void JSObject::SetProperty(const JSString& property_name, const JSValue& property_value, const std::unordered_set<JSPropertyAttribute>& attributes) {
+  void JSObject::SetProperty(const JSString& property_name, const JSValue& property_value, JSPropertyAttributeSet attributes) {
     HAL_JSOBJECT_LOCK_GUARD;
     
     JSValueRef exception { nullptr };
@@ -72,6 +91,36 @@ namespace HAL {
     }
   }
   
+  void JSObject::SetProperties(const std::vector<std::pair<JSString, JSValue>>& properties, JSPropertyAttributeSet attributes) {
+    SetProperties(properties.begin(), properties.end(), attributes);
+  }
+  
+  void JSObject::SetBatchedProperty(const JSString& property_name, const JSValue& property_value, unsigned js_property_attributes) {
+    JSValueRef exception { nullptr };
+    JSObjectSetProperty(static_cast<JSContextRef>(js_context__), js_object_ref__, static_cast<JSStringRef>(property_name), static_cast<JSValueRef>(property_value), js_property_attributes, &exception);
+    if (exception) {
+      detail::ThrowRuntimeError("JSObject", JSValue(js_context__, exception));
+    }
+  }
+  
+  std::vector<JSValue> JSObject::GetProperties(const std::vector<JSString>& property_names) const {
+    HAL_JSOBJECT_LOCK_GUARD;
+    const auto js_context_ref = static_cast<JSContextRef>(js_context__);
+    
+    std::vector<JSValue> property_values;
+    property_values.reserve(property_names.size());
+    JSValueRef exception { nullptr };
+    for (const auto& property_name : property_names) {
+      JSValueRef js_value_ref = JSObjectGetProperty(js_context_ref, js_object_ref__, static_cast<JSStringRef>(property_name), &exception);
+      if (exception) {
+        detail::ThrowRuntimeError("JSObject", JSValue(js_context__, exception));
+      }
+      property_values.push_back(JSValue(js_context__, js_value_ref));
+    }
+    
+    return property_values;
+  }
+  
   void JSObject::SetProperty(unsigned property_index, const JSValue& property_value) {
     HAL_JSOBJECT_LOCK_GUARD;
     
@@ -82,6 +131,60 @@ namespace HAL {
     }
   }
   
+  JSResult<JSValue> JSObject::TryGetProperty(const JSString& property_name) const HAL_NOEXCEPT {
+    HAL_JSOBJECT_LOCK_GUARD;
+    JSValueRef exception { nullptr };
+    JSValueRef js_value_ref = JSObjectGetProperty(static_cast<JSContextRef>(js_context__), js_object_ref__, static_cast<JSStringRef>(property_name), &exception);
+    if (exception) {
+      // If this assert fails then we need to JSValueUnprotect
+      // js_value_ref.
+      assert(!js_value_ref);
+      return JSException("JSObject", JSValue(js_context__, exception));
+    }
+    
+    assert(js_value_ref);
+    return JSValue(js_context__, js_value_ref);
+  }
+  
+  JSResult<JSValue> JSObject::TryGetProperty(unsigned property_index) const HAL_NOEXCEPT {
+    HAL_JSOBJECT_LOCK_GUARD;
+    JSValueRef exception { nullptr };
+    JSValueRef js_value_ref = JSObjectGetPropertyAtIndex(static_cast<JSContextRef>(js_context__), js_object_ref__, property_index, &exception);
+    if (exception) {
+      // If this assert fails then we need to JSValueUnprotect
+      // js_value_ref.
+      assert(!js_value_ref);
+      return JSException("JSObject", JSValue(js_context__, exception));
+    }
+    
+    assert(js_value_ref);
+    return JSValue(js_context__, js_value_ref);
+  }
+  
+  JSResult<void> JSObject::TrySetProperty(const JSString& property_name, const JSValue& property_value, JSPropertyAttributeSet attributes) HAL_NOEXCEPT {
+    HAL_JSOBJECT_LOCK_GUARD;
+    
+    JSValueRef exception { nullptr };
+    JSObjectSetProperty(static_cast<JSContextRef>(js_context__), js_object_ref__, static_cast<JSStringRef>(property_name), static_cast<JSValueRef>(property_value), detail::ToJSPropertyAttributes(attributes), &exception);
+    if (exception) {
+      return JSException("JSObject", JSValue(js_context__, exception));
+    }
+    
+    return JSResult<void>();
+  }
+  
+  JSResult<void> JSObject::TrySetProperty(unsigned property_index, const JSValue& property_value) HAL_NOEXCEPT {
+    HAL_JSOBJECT_LOCK_GUARD;
+    
+    JSValueRef exception { nullptr };
+    JSObjectSetPropertyAtIndex(static_cast<JSContextRef>(js_context__), js_object_ref__, property_index, static_cast<JSValueRef>(property_value), &exception);
+    if (exception) {
+      return JSException("JSObject", JSValue(js_context__, exception));
+    }
+    
+    return JSResult<void>();
+  }
+  
   bool JSObject::DeleteProperty(const JSString& property_name) {
     HAL_JSOBJECT_LOCK_GUARD;
     
@@ -102,54 +205,87 @@ namespace HAL {
   std::unordered_map<std::string, JSValue> JSObject::GetProperties() const HAL_NOEXCEPT {
     HAL_JSOBJECT_LOCK_GUARD;
     std::unordered_map<std::string, JSValue> properties;
-    for (const auto& property_name : static_cast<std::vector<JSString>>(GetPropertyNames())) {
-      properties.emplace(property_name, GetProperty(property_name));
+    const auto property_names = GetPropertyNames();
+    properties.reserve(property_names.GetCount());
+    for (const auto property_name : property_names) {
+      properties.emplace(static_cast<std::string>(property_name), GetProperty(property_name));
     }
     return properties;
   }
   
+  void JSObject::ForEachProperty(const std::function<void(const JSStringView& property_name, const JSValueView& property_value)>& callback) const {
+    HAL_JSOBJECT_LOCK_GUARD;
+    const auto js_context_ref = static_cast<JSContextRef>(js_context__);
+    for (const auto property_name : GetPropertyNames()) {
+      JSValueRef exception { nullptr };
+      JSValueRef js_value_ref = JSObjectGetProperty(js_context_ref, js_object_ref__, static_cast<JSStringRef>(property_name), &exception);
+      if (exception) {
+        detail::ThrowRuntimeError("JSObject", JSValue(js_context__, exception));
+      }
+      
+      // js_value_ref is on the stack for the duration of the
+      // callback, so it doesn't need to be protected.
+      callback(property_name, JSValueView(js_context_ref, js_value_ref));
+    }
+  }
+  
   bool JSObject::IsFunction() const HAL_NOEXCEPT {
     return JSObjectIsFunction(static_cast<JSContextRef>(js_context__), js_object_ref__);
   }
 
   bool JSObject::IsArray() const HAL_NOEXCEPT {
     HAL_JSOBJECT_LOCK_GUARD;
-
-    JSObject global_object = js_context__.get_global_object();
-    JSValue array_value = global_object.GetProperty("Array");
-    if (!array_value.IsObject()) {
+    const auto js_context_ref = static_cast<JSContextRef>(js_context__);
+#ifdef HAL_JSVALUE_IS_ARRAY_ENABLE
+    return JSValueIsArray(js_context_ref, js_object_ref__);
+#else
+    const auto& builtins = js_context__.GetBuiltins();
+    if (builtins.array_is_array.IsUndefined()) {
       return false;
     }
     
-    JSObject array = static_cast<JSObject>(array_value);
-    JSValue isArray_value = array.GetProperty("isArray");
-    if (!isArray_value.IsObject()) {
-      return false;
-    }
-    JSObject isArray = static_cast<JSObject>(isArray_value);
-    if (!isArray.IsFunction()) {
-      return false;
-    }
-
-    JSValue self = static_cast<JSValue>(*this);
-    JSValue result = isArray(self, global_object);
-    if (result.IsBoolean()) {
-        return static_cast<bool>(result);
-    }
-    
-    return false;
+    // A JSValueRef of an object is its JSObjectRef.
+    const auto array_is_array_ref = const_cast<JSObjectRef>(static_cast<JSValueRef>(builtins.array_is_array));
+    const JSValueRef arguments[] = { js_object_ref__ };
+    JSValueRef exception { nullptr };
+    JSValueRef result = JSObjectCallAsFunction(js_context_ref, array_is_array_ref, nullptr, 1, arguments, &exception);
+    return !exception && JSValueIsBoolean(js_context_ref, result) && JSValueToBoolean(js_context_ref, result);
+#endif
   }
   
   bool JSObject::IsError() const HAL_NOEXCEPT {
     HAL_JSOBJECT_LOCK_GUARD;
-    const auto global_object = js_context__.get_global_object();
-    const auto error_value = global_object.GetProperty("Error");
-    if (!error_value.IsObject()) {
+    const auto js_context_ref = static_cast<JSContextRef>(js_context__);
+    const auto& builtins = js_context__.GetBuiltins();
+    if (builtins.error_constructor.IsUndefined()) {
+      return false;
+    }
+    
+    // A JSValueRef of an object is its JSObjectRef.
+    const auto error_constructor_ref = const_cast<JSObjectRef>(static_cast<JSValueRef>(builtins.error_constructor));
+    if (JSValueIsInstanceOfConstructor(js_context_ref, js_object_ref__, error_constructor_ref, nullptr)) {
+      return true;
+    }
+    
+    // Only stringify objects that aren't instances of this execution
+    // context's Error, e.g. errors from other execution contexts.
+    JSValueRef exception { nullptr };
+    JSStringRef js_string_ref = JSValueToStringCopy(js_context_ref, js_object_ref__, &exception);
+    if (exception) {
       return false;
     }
-    const auto error = static_cast<JSObject>(error_value);
-    const auto self  = static_cast<JSValue>(*this);
-    return static_cast<std::string>(self) == "[object Error]" || self.IsInstanceOfConstructor(error);
+    const bool is_error = JSStringIsEqualToUTF8CString(js_string_ref, "[object Error]");
+    JSStringRelease(js_string_ref);
+    return is_error;
+  }
+  
+  bool JSObject::IsArrayBuffer() const HAL_NOEXCEPT {
+    return JSValueGetTypedArrayType(static_cast<JSContextRef>(js_context__), js_object_ref__, nullptr) == kJSTypedArrayTypeArrayBuffer;
+  }
+  
+  bool JSObject::IsTypedArray() const HAL_NOEXCEPT {
+    const auto type = JSValueGetTypedArrayType(static_cast<JSContextRef>(js_context__), js_object_ref__, nullptr);
+    return type != kJSTypedArrayTypeNone && type != kJSTypedArrayTypeArrayBuffer;
   }
   
   JSValue JSObject::operator()(                                        JSObject this_object) { return CallAsFunction(std::vector<JSValue>()                      , this_object); }
@@ -214,6 +350,9 @@ namespace HAL {
   
   JSObject::~JSObject() HAL_NOEXCEPT {
     HAL_LOG_TRACE("JSObject:: dtor ", this);
+    if (borrowed__) {
+      return;
+    }
     HAL_LOG_TRACE("JSObject:: release ", js_object_ref__, " for ", this);
     JSValueUnprotect(static_cast<JSContextRef>(js_context__), js_object_ref__);
     UnRegisterJSContext(js_object_ref__);
@@ -259,6 +398,7 @@ namespace HAL {
     // effectively swapped.
     swap(js_context__   , other.js_context__);
     swap(js_object_ref__, other.js_object_ref__);
+    swap(borrowed__     , other.borrowed__);
   }
   
   JSObject::JSObject(const JSContext& js_context, const JSClass& js_class, void* private_data)
@@ -280,6 +420,20 @@ namespace HAL {
     RegisterJSContext(static_cast<JSContextRef>(js_context__), js_object_ref__);
   }
   
+  JSObject::JSObject(const JSContext& js_context, JSObjectRef js_object_ref, BorrowedTag) HAL_NOEXCEPT
+  : js_context__(js_context, JSContext::BorrowedTag())
+  , js_object_ref__(js_object_ref)
+  , borrowed__(true) {
+    HAL_LOG_TRACE("JSObject:: ctor 3 (borrowed) ", this);
+  }
+  
+  JSObject::JSObject(JSContextRef js_context_ref, JSObjectRef js_object_ref, BorrowedTag) HAL_NOEXCEPT
+  : js_context__(js_context_ref, JSContext::BorrowedTag())
+  , js_object_ref__(js_object_ref)
+  , borrowed__(true) {
+    HAL_LOG_TRACE("JSObject:: ctor 4 (borrowed) ", this);
+  }
+  
   JSObject::operator JSValue() const {
     return JSValue(js_context__, js_object_ref__);
   }
@@ -292,6 +446,10 @@ namespace HAL {
     return JSError(js_context__, js_object_ref__);
   }
   
+  JSObject::operator JSArrayBuffer() const {
+    return JSArrayBuffer(js_context__, js_object_ref__);
+  }
+  
   JSValue JSObject::CallAsFunction(const std::vector<JSValue>&  arguments, JSObject this_object) {
     HAL_JSOBJECT_LOCK_GUARD;
     
@@ -319,9 +477,36 @@ namespace HAL {
     return JSValue(js_context__, js_value_ref);
   }
   
+  JSResult<JSValue> JSObject::TryCallAsFunction(const std::vector<JSValue>& arguments, JSObject this_object) HAL_NOEXCEPT {
+    HAL_JSOBJECT_LOCK_GUARD;
+    
+    if (!IsFunction()) {
+      return JSException("JSObject", js_context__, "This JavaScript object is not a function.");
+    }
+    
+    JSValueRef exception { nullptr };
+    JSValueRef js_value_ref { nullptr };
+    if (!arguments.empty()) {
+      const auto arguments_array = detail::to_vector(arguments);
+      js_value_ref = JSObjectCallAsFunction(static_cast<JSContextRef>(js_context__), js_object_ref__, static_cast<JSObjectRef>(this_object), arguments_array.size(), &arguments_array[0], &exception);
+    } else {
+      js_value_ref = JSObjectCallAsFunction(static_cast<JSContextRef>(js_context__), js_object_ref__, static_cast<JSObjectRef>(this_object), 0, nullptr, &exception);
+    }
+    
+    if (exception) {
+      // If this assert fails then we need to JSValueUnprotect
+      // js_value_ref.
+      assert(!js_value_ref);
+      return JSException("JSObject", JSValue(js_context__, exception));
+    }
+    
+    assert(js_value_ref);
+    return JSValue(js_context__, js_value_ref);
+  }
+  
   void JSObject::GetPropertyNames(const JSPropertyNameAccumulator& accumulator) const HAL_NOEXCEPT {
     HAL_JSOBJECT_LOCK_GUARD;
-    for (const auto& property_name : static_cast<std::vector<JSString>>(GetPropertyNames())) {
+    for (const auto property_name : GetPropertyNames()) {
       accumulator.AddName(property_name);
     }
   }
@@ -0,0 +1,156 @@
+/**
+ * HAL
+ *
+ * Copyright (c) 2014 by Appcelerator, Inc. All Rights Reserved.
+ * Licensed under the terms of the Apache Public License.
+ * Please see the LICENSE included with this distribution for details.
+ */
+
+#include "HAL/JSObjectTemplate.hpp"
+#include "HAL/JSUndefined.hpp"
+#include "HAL/JSFunction.hpp"
+#include "HAL/detail/JSUtil.hpp"
+
+#include <cassert>
+#include <cstdio>
+#include <stdexcept>
+#include <string>
+
+namespace HAL {
+
+  namespace {
+
+    // Return property_name as a JavaScript string literal. The
+    // property names come from native code, so escape everything that
+    // can't appear unescaped between double quotes.
+    std::string ToStringLiteral(const std::string& property_name) {
+      std::string literal = "\"";
+      for (std::size_t i = 0; i < property_name.size(); ++i) {
+        const unsigned char c = static_cast<unsigned char>(property_name[i]);
+        if (c == '"' || c == '\\') {
+          literal += '\\';
+          literal += static_cast<char>(c);
+        } else if (c < 0x20) {
+          char escape[7];
+          std::snprintf(escape, sizeof(escape), "\\u%04x", c);
+          literal += escape;
+        } else if (c == 0xE2 && i + 2 < property_name.size() && static_cast<unsigned char>(property_name[i + 1]) == 0x80 && (static_cast<unsigned char>(property_name[i + 2]) & 0xFE) == 0xA8) {
+          // U+2028 and U+2029 are line terminators in string literals.
+          literal += static_cast<unsigned char>(property_name[i + 2]) == 0xA8 ? "\\u2028" : "\\u2029";
+          i += 2;
+        } else {
+          literal += static_cast<char>(c);
+        }
+      }
+
+      literal += '"';
+      return literal;
+    }
+
+  } // namespace {
+
+  JSObjectTemplate::JSObjectTemplate(const JSContext& js_context, const std::vector<JSString>& property_names)
+  : js_context__(js_context)
+  , property_names__(property_names)
+  , js_constructor__(js_context.CreateUndefined()) {
+
+    // Compile "return {"name0": p0, "name1": p1, ...};" so that every
+    // object has its properties added in the same order by a single
+    // object literal, and so shares one structure.
+    std::vector<JSString> parameter_names;
+    parameter_names.reserve(property_names__.size());
+    std::string body = "return {";
+    for (std::size_t i = 0; i < property_names__.size(); ++i) {
+      const std::string parameter_name = "p" + std::to_string(i);
+      if (i > 0) {
+        body += ", ";
+      }
+      body += ToStringLiteral(static_cast<std::string>(property_names__[i]));
+      body += ": ";
+      body += parameter_name;
+      parameter_names.emplace_back(parameter_name);
+    }
+    body += "};";
+
+    try {
+      const JSFunction js_constructor = js_context__.CreateFunction(body, parameter_names);
+      js_constructor_ref__ = static_cast<JSObjectRef>(js_constructor);
+      js_constructor__     = js_constructor;
+    } catch (const detail::js_runtime_error&) {
+      // The object literal didn't compile, e.g. because it repeats
+      // "__proto__". Fall back to setting the properties one at a
+      // time.
+      js_constructor_ref__ = nullptr;
+    }
+  }
+
+  JSObject JSObjectTemplate::Instantiate(const JSValue* values, std::size_t count) const {
+    if (count != property_names__.size()) {
+      detail::ThrowInvalidArgument("JSObjectTemplate", "Expected " + std::to_string(property_names__.size()) + " values but got " + std::to_string(count));
+    }
+
+    // The JSValues keep their JSValueRefs alive.
+    std::vector<JSValueRef> js_value_refs;
+    js_value_refs.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+      js_value_refs.push_back(static_cast<JSValueRef>(values[i]));
+    }
+
+    return JSObject(js_context__, MakeObject(js_value_refs.empty() ? nullptr : &js_value_refs[0], false));
+  }
+
+  JSObject JSObjectTemplate::Instantiate(const std::vector<JSValue>& values) const {
+    return Instantiate(values.empty() ? nullptr : &values[0], values.size());
+  }
+
+  JSObjectRef JSObjectTemplate::MakeObject(const JSValueRef values[], bool unprotect) const {
+    const auto js_context_ref = static_cast<JSContextRef>(js_context__);
+    const auto count          = property_names__.size();
+
+    JSValueRef  exception     { nullptr };
+    JSObjectRef js_object_ref { nullptr };
+    if (js_constructor_ref__) {
+      JSValueRef js_value_ref = JSObjectCallAsFunction(js_context_ref, js_constructor_ref__, nullptr, count, values, &exception);
+      if (!exception) {
+        js_object_ref = JSValueToObject(js_context_ref, js_value_ref, &exception);
+      }
+    } else {
+      js_object_ref = JSObjectMake(js_context_ref, nullptr, nullptr);
+      for (std::size_t i = 0; i < count && !exception; ++i) {
+        JSObjectSetProperty(js_context_ref, js_object_ref, static_cast<JSStringRef>(property_names__[i]), values[i], kJSPropertyAttributeNone, &exception);
+      }
+    }
+
+    // The object, which is on the stack, now keeps the values alive.
+    if (unprotect) {
+      for (std::size_t i = 0; i < count; ++i) {
+        JSValueUnprotect(js_context_ref, values[i]);
+      }
+    }
+
+    if (exception) {
+      detail::ThrowRuntimeError("JSObjectTemplate", JSValue(js_context__, exception));
+    }
+
+    assert(js_object_ref);
+    return js_object_ref;
+  }
+
+  JSValueRef JSObjectTemplate::MakeProtectedObject(const std::vector<JSValueRef>& js_value_refs) const {
+    assert(js_value_refs.size() == property_names__.size());
+    JSObjectRef js_object_ref = MakeObject(js_value_refs.empty() ? nullptr : &js_value_refs[0], true);
+    JSValueProtect(static_cast<JSContextRef>(js_context__), js_object_ref);
+    return js_object_ref;
+  }
+
+  void JSObjectTemplate::ThrowIfFieldsDiffer(const std::vector<JSString>& property_names) const {
+    if (property_names != property_names__) {
+      detail::ThrowInvalidArgument("JSObjectTemplate", "The field descriptor's property names differ from the template's property names");
+    }
+  }
+
+  JSArray JSObjectTemplate::MakeArray(const JSContext& js_context, const std::vector<JSValueRef>& js_object_refs) {
+    return JSArray(js_context, JSArray::MakeArray(js_context, js_object_refs, true));
+  }
+
+} // namespace HAL {
@@ -36,6 +36,18 @@ namespace HAL {
     return property_names;
   }
   
+  JSPropertyNameArray::const_iterator JSPropertyNameArray::begin() const HAL_NOEXCEPT {
+    return const_iterator(js_property_name_array_ref__, 0);
+  }
+  
+  JSPropertyNameArray::const_iterator JSPropertyNameArray::end() const HAL_NOEXCEPT {
+    return const_iterator(js_property_name_array_ref__, GetCount());
+  }
+  
+  JSStringView JSPropertyNameArray::const_iterator::operator*() const HAL_NOEXCEPT {
+    return JSStringView(JSPropertyNameArrayGetNameAtIndex(js_property_name_array_ref__, index__));
+  }
+  
   JSPropertyNameArray::~JSPropertyNameArray() HAL_NOEXCEPT {
     HAL_LOG_TRACE("JSPropertyNameArray:: dtor ", this);
     HAL_LOG_TRACE("JSPropertyNameArray:: release ", js_property_name_array_ref__, " for ", this);
@@ -0,0 +1,29 @@
+/**
+ * HAL
+ *
+ * Copyright (c) 2014 by Appcelerator, Inc. All Rights Reserved.
+ * Licensed under the terms of the Apache Public License.
+ * Please see the LICENSE included with this distribution for details.
+ */
+
+#include "HAL/JSSharedBuffer.hpp"
+
+namespace HAL {
+
+  JSSharedBuffer::JSSharedBuffer(std::vector<std::uint8_t> bytes)
+  : byte_length__(bytes.size()) {
+    // Share ownership of the vector while pointing at its elements.
+    const auto vector_ptr = std::make_shared<std::vector<std::uint8_t>>(std::move(bytes));
+    bytes__ = std::shared_ptr<const std::uint8_t>(vector_ptr, vector_ptr -> data());
+  }
+
+  JSSharedBuffer::JSSharedBuffer(const void* bytes, std::size_t byte_length, JSBytesDeallocator deallocator)
+  : bytes__(static_cast<const std::uint8_t*>(bytes), [deallocator](const std::uint8_t* bytes) {
+    if (deallocator) {
+      deallocator(const_cast<std::uint8_t*>(bytes));
+    }
+  })
+  , byte_length__(byte_length) {
+  }
+
+} // namespace HAL {
@@ -0,0 +1,43 @@
+/**
+ * HAL
+ *
+ * Copyright (c) 2014 by Appcelerator, Inc. All Rights Reserved.
+ * Licensed under the terms of the Apache Public License.
+ * Please see the LICENSE included with this distribution for details.
+ */
+
+#include "HAL/JSStringView.hpp"
+#include "HAL/JSString.hpp"
+
+#include <codecvt>
+#include <locale>
+
+namespace HAL {
+  
+  std::size_t JSStringView::length() const HAL_NOEXCEPT {
+    return JSStringGetLength(js_string_ref__);
+  }
+  
+  const JSChar* JSStringView::data() const HAL_NOEXCEPT {
+    return JSStringGetCharactersPtr(js_string_ref__);
+  }
+  
+  JSStringView::operator std::string() const HAL_NOEXCEPT {
+    static std::wstring_convert<std::codecvt_utf8_utf16<char16_t>, char16_t> converter;
+    const JSChar* string_ptr = data();
+    return converter.to_bytes(std::u16string(string_ptr, string_ptr + length()));
+  }
+  
+  JSStringView::operator JSString() const HAL_NOEXCEPT {
+    return JSString(js_string_ref__);
+  }
+  
+  bool operator==(const JSStringView& lhs, const char* rhs) HAL_NOEXCEPT {
+    return JSStringIsEqualToUTF8CString(static_cast<JSStringRef>(lhs), rhs);
+  }
+  
+  bool operator==(const JSStringView& lhs, const JSString& rhs) HAL_NOEXCEPT {
+    return JSStringIsEqual(static_cast<JSStringRef>(lhs), static_cast<JSStringRef>(rhs));
+  }
+  
+} // namespace HAL {
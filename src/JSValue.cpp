@@ -10,6 +10,7 @@
 
 #include "HAL/JSContext.hpp"
 #include "HAL/JSString.hpp"
+#include "HAL/JSONSink.hpp"
 
 #include "HAL/JSUndefined.hpp"
 #include "HAL/JSNull.hpp"
@@ -22,6 +23,7 @@
 #include "HAL/JSError.hpp"
 #include "HAL/JSFunction.hpp"
 #include "HAL/JSRegExp.hpp"
+#include "HAL/JSResult.hpp"
 
 #include "HAL/JSClass.hpp"
 
@@ -53,6 +55,33 @@ namespace HAL {
     return JSString();
   }
   
+  bool JSValue::WriteJSON(JSONSink& sink, unsigned indent) const {
+    HAL_JSVALUE_LOCK_GUARD;
+    JSValueRef exception { nullptr };
+    JSStringRef js_string_ref = JSValueCreateJSONString(static_cast<JSContextRef>(js_context__), js_value_ref__, indent, &exception);
+    if (exception) {
+      // If this assert fails then we need to JSStringRelease
+      // js_string_ref.
+      assert(!js_string_ref);
+      detail::ThrowRuntimeError("JSValue", JSValue(js_context__, exception));
+    }
+    
+    if (!js_string_ref) {
+      return false;
+    }
+    
+    try {
+      sink.WriteUTF16(JSStringGetCharactersPtr(js_string_ref), JSStringGetLength(js_string_ref));
+      sink.Flush();
+    } catch (...) {
+      JSStringRelease(js_string_ref);
+      throw;
+    }
+    
+    JSStringRelease(js_string_ref);
+    return true;
+  }
+  
   JSValue::operator JSString() const {
     HAL_JSVALUE_LOCK_GUARD;
     JSValueRef exception { nullptr };
@@ -112,6 +141,61 @@ namespace HAL {
     return JSObject(js_context__, js_object_ref);
   }
   
+  JSResult<JSString> JSValue::TryToString() const HAL_NOEXCEPT {
+    HAL_JSVALUE_LOCK_GUARD;
+    JSValueRef exception { nullptr };
+    JSStringRef js_string_ref = JSValueToStringCopy(static_cast<JSContextRef>(js_context__), js_value_ref__, &exception);
+    if (exception) {
+      // If this assert fails then we need to JSStringRelease
+      // js_string_ref.
+      assert(!js_string_ref);
+      return JSException("JSValue", JSValue(js_context__, exception));
+    }
+    
+    assert(js_string_ref);
+    JSString js_string(js_string_ref);
+    JSStringRelease(js_string_ref);
+    
+    return js_string;
+  }
+  
+  JSResult<double> JSValue::TryToNumber() const HAL_NOEXCEPT {
+    HAL_JSVALUE_LOCK_GUARD;
+    JSValueRef exception { nullptr };
+    const double result = JSValueToNumber(static_cast<JSContextRef>(js_context__), js_value_ref__, &exception);
+    if (exception) {
+      return JSException("JSValue", JSValue(js_context__, exception));
+    }
+    
+    return result;
+  }
+  
+  JSResult<int32_t> JSValue::TryToInt32() const HAL_NOEXCEPT {
+    HAL_JSVALUE_LOCK_GUARD;
+    JSValueRef exception { nullptr };
+    const double result = JSValueToNumber(static_cast<JSContextRef>(js_context__), js_value_ref__, &exception);
+    if (exception) {
+      return JSException("JSValue", JSValue(js_context__, exception));
+    }
+    
+    return detail::to_int32_t(result);
+  }
+  
+  JSResult<JSObject> JSValue::TryToObject() const HAL_NOEXCEPT {
+    HAL_JSVALUE_LOCK_GUARD;
+    JSValueRef exception { nullptr };
+    JSObjectRef js_object_ref = JSValueToObject(static_cast<JSContextRef>(js_context__), js_value_ref__, &exception);
+    if (exception) {
+      // If this assert fails then we need to JSValueUnprotect
+      // js_object_ref.
+      assert(!js_object_ref);
+      return JSException("JSValue", JSValue(js_context__, exception));
+    }
+    
+    assert(js_object_ref);
+    return JSObject(js_context__, js_object_ref);
+  }
+  
   JSValue::Type JSValue::GetType() const HAL_NOEXCEPT {
     HAL_JSVALUE_LOCK_GUARD;
     auto type = Type::Undefined;
@@ -0,0 +1,102 @@
+/**
+ * HAL
+ *
+ * Copyright (c) 2014 by Appcelerator, Inc. All Rights Reserved.
+ * Licensed under the terms of the Apache Public License.
+ * Please see the LICENSE included with this distribution for details.
+ */
+
+#include "HAL/JSValueView.hpp"
+
+#include "HAL/JSString.hpp"
+#include "HAL/JSValue.hpp"
+#include "HAL/JSObject.hpp"
+
+#include "HAL/detail/JSUtil.hpp"
+
+#include <cassert>
+
+namespace HAL {
+  
+  JSContext JSValueView::get_context() const HAL_NOEXCEPT {
+    return JSContext(js_context_ref__);
+  }
+  
+  JSValueView::operator JSValue() const {
+    return JSValue(get_context(), js_value_ref__);
+  }
+  
+  JSValueView::operator JSString() const {
+    JSValueRef exception { nullptr };
+    JSStringRef js_string_ref = JSValueToStringCopy(js_context_ref__, js_value_ref__, &exception);
+    if (exception) {
+      // If this assert fails then we need to JSStringRelease
+      // js_string_ref.
+      assert(!js_string_ref);
+      detail::ThrowRuntimeError("JSValueView", JSValue(get_context(), exception));
+    }
+    
+    assert(js_string_ref);
+    JSString js_string(js_string_ref);
+    JSStringRelease(js_string_ref);
+    
+    return js_string;
+  }
+  
+  JSValueView::operator std::string() const {
+    return operator JSString();
+  }
+  
+  JSValueView::operator bool() const HAL_NOEXCEPT {
+    return JSValueToBoolean(js_context_ref__, js_value_ref__);
+  }
+  
+  JSValueView::operator double() const {
+    JSValueRef exception { nullptr };
+    const double result = JSValueToNumber(js_context_ref__, js_value_ref__, &exception);
+    if (exception) {
+      detail::ThrowRuntimeError("JSValueView", JSValue(get_context(), exception));
+    }
+    
+    return result;
+  }
+  
+  JSValueView::operator int32_t() const {
+    return detail::to_int32_t(operator double());
+  }
+  
+  JSValueView::operator uint32_t() const {
+    // ToInt32 and ToUint32 only differ in how the result is
+    // interpreted, as for JSValue.
+    return static_cast<uint32_t>(operator int32_t());
+  }
+  
+  JSValueView::operator JSObject() const {
+    return static_cast<JSObject>(operator JSValue());
+  }
+  
+  bool JSValueView::IsUndefined() const HAL_NOEXCEPT {
+    return JSValueIsUndefined(js_context_ref__, js_value_ref__);
+  }
+  
+  bool JSValueView::IsNull() const HAL_NOEXCEPT {
+    return JSValueIsNull(js_context_ref__, js_value_ref__);
+  }
+  
+  bool JSValueView::IsBoolean() const HAL_NOEXCEPT {
+    return JSValueIsBoolean(js_context_ref__, js_value_ref__);
+  }
+  
+  bool JSValueView::IsNumber() const HAL_NOEXCEPT {
+    return JSValueIsNumber(js_context_ref__, js_value_ref__);
+  }
+  
+  bool JSValueView::IsString() const HAL_NOEXCEPT {
+    return JSValueIsString(js_context_ref__, js_value_ref__);
+  }
+  
+  bool JSValueView::IsObject() const HAL_NOEXCEPT {
+    return JSValueIsObject(js_context_ref__, js_value_ref__);
+  }
+  
+} // namespace HAL {
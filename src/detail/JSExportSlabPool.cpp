@@ -0,0 +1,170 @@
+/**
+ * HAL
+ *
+ * Copyright (c) 2014 by Appcelerator, Inc. All Rights Reserved.
+ * Licensed under the terms of the Apache Public License.
+ * Please see the LICENSE included with this distribution for details.
+ */
+
+#include "HAL/detail/JSExportSlabPool.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <functional>
+#include <new>
+#include <type_traits>
+
+namespace HAL { namespace detail {
+
+  JSExportSlabPool::JSExportSlabPool(std::size_t object_size, std::size_t object_alignment, std::size_t slots_per_slab) {
+    assert(object_alignment > 0);
+    assert(slots_per_slab > 0);
+
+    // A free slot holds the free list link, and every slot must start
+    // on a multiple of the object's alignment.
+    const std::size_t alignment = std::max(object_alignment, std::alignment_of<FreeSlot>::value);
+    const std::size_t slot_size = std::max(object_size, sizeof(FreeSlot));
+    statistics__.slot_size      = (slot_size + alignment - 1) / alignment * alignment;
+    statistics__.slots_per_slab = slots_per_slab;
+  }
+
+  JSExportSlabPool::~JSExportSlabPool() HAL_NOEXCEPT {
+    {
+      HAL_DETAIL_JSEXPORTSLABPOOL_LOCK_GUARD_STATIC;
+      auto& slab_index = GetSlabIndex();
+      for (auto slab : slabs__) {
+        slab_index.erase(static_cast<const unsigned char*>(slab));
+      }
+    }
+
+    for (auto slab : slabs__) {
+      ::operator delete(slab);
+    }
+  }
+
+  void* JSExportSlabPool::Allocate() {
+    HAL_DETAIL_JSEXPORTSLABPOOL_LOCK_GUARD;
+    if (!free_list__) {
+      AllocateSlab();
+    }
+
+    FreeSlot* slot = free_list__;
+    free_list__    = slot -> next;
+
+    ++statistics__.in_use;
+    ++statistics__.total_allocations;
+    statistics__.peak_in_use = std::max(statistics__.peak_in_use, statistics__.in_use);
+
+    return slot;
+  }
+
+  void JSExportSlabPool::Deallocate(void* slot) HAL_NOEXCEPT {
+    if (!slot) {
+      return;
+    }
+
+    HAL_DETAIL_JSEXPORTSLABPOOL_LOCK_GUARD;
+    assert(statistics__.in_use > 0);
+    auto free_slot    = static_cast<FreeSlot*>(slot);
+    free_slot -> next = free_list__;
+    free_list__       = free_slot;
+    --statistics__.in_use;
+  }
+
+  JSExportPoolStatistics JSExportSlabPool::get_statistics() const HAL_NOEXCEPT {
+    HAL_DETAIL_JSEXPORTSLABPOOL_LOCK_GUARD;
+    return statistics__;
+  }
+
+  bool JSExportSlabPool::Owns(const void* slot) const HAL_NOEXCEPT {
+    return FindPool(slot) == this;
+  }
+
+  bool JSExportSlabPool::DeallocateIfPooled(void* slot) HAL_NOEXCEPT {
+    // Don't hold the static lock while deallocating, because
+    // AllocateSlab takes it while holding the pool's lock. A pool
+    // that owns a live slot isn't going away.
+    const auto pool = FindPool(slot);
+    if (!pool) {
+      return false;
+    }
+
+    pool -> Deallocate(slot);
+    return true;
+  }
+
+  JSExportSlabPool& JSExportSlabPool::GetOrCreate(std::atomic<JSExportSlabPool*>& pool_ptr, std::size_t object_size, std::size_t object_alignment, std::size_t slots_per_slab) {
+    auto pool = pool_ptr.load(std::memory_order_acquire);
+    if (!pool) {
+      HAL_DETAIL_JSEXPORTSLABPOOL_LOCK_GUARD_STATIC;
+      pool = pool_ptr.load(std::memory_order_relaxed);
+      if (!pool) {
+        pool = new JSExportSlabPool(object_size, object_alignment, slots_per_slab);
+        pool_ptr.store(pool, std::memory_order_release);
+      }
+    }
+    return *pool;
+  }
+
+  JSExportSlabPool* JSExportSlabPool::FindPool(const void* slot) HAL_NOEXCEPT {
+    const auto address = static_cast<const unsigned char*>(slot);
+
+    HAL_DETAIL_JSEXPORTSLABPOOL_LOCK_GUARD_STATIC;
+    const auto& slab_index = GetSlabIndex();
+
+    // The last slab that starts at or before address is the only one
+    // that can contain it.
+    auto position = slab_index.upper_bound(address);
+    if (position == slab_index.begin()) {
+      return nullptr;
+    }
+
+    --position;
+    return std::less<const unsigned char*>()(address, position -> second.end) ? position -> second.pool : nullptr;
+  }
+
+  std::map<const unsigned char*, JSExportSlabPool::SlabIndexEntry>& JSExportSlabPool::GetSlabIndex() HAL_NOEXCEPT {
+    // Never destroyed, like the pools of JSExportPoolAllocator. The
+    // callers hold the static lock, so the first call is serialized
+    // even where function-local statics aren't initialized
+    // thread-safely.
+    static auto slab_index_ptr = new std::map<const unsigned char*, SlabIndexEntry>();
+    return *slab_index_ptr;
+  }
+
+#ifdef HAL_THREAD_SAFE
+  std::mutex JSExportSlabPool::mutex_static__;
+#endif
+
+  void JSExportSlabPool::AllocateSlab() {
+    // Make room for the slab pointer first so that only adding the
+    // slab to the index can throw after the slab has been allocated.
+    const auto slab_size = statistics__.slot_size * statistics__.slots_per_slab;
+    slabs__.push_back(nullptr);
+    auto slab = static_cast<unsigned char*>(::operator new(slab_size, std::nothrow));
+    if (!slab) {
+      slabs__.pop_back();
+      throw std::bad_alloc();
+    }
+
+    try {
+      HAL_DETAIL_JSEXPORTSLABPOOL_LOCK_GUARD_STATIC;
+      GetSlabIndex().emplace(slab, SlabIndexEntry { slab + slab_size, this });
+    } catch (...) {
+      ::operator delete(slab);
+      slabs__.pop_back();
+      throw;
+    }
+
+    slabs__.back() = slab;
+    ++statistics__.slab_count;
+
+    // Thread the slots onto the free list in address order.
+    for (std::size_t i = statistics__.slots_per_slab; i > 0; --i) {
+      auto free_slot    = reinterpret_cast<FreeSlot*>(slab + (i - 1) * statistics__.slot_size);
+      free_slot -> next = free_list__;
+      free_list__       = free_slot;
+    }
+  }
+
+}} // namespace HAL { namespace detail {
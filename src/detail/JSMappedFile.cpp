@@ -0,0 +1,114 @@
+/**
+ * HAL
+ *
+ * Copyright (c) 2014 by Appcelerator, Inc. All Rights Reserved.
+ * Licensed under the terms of the Apache Public License.
+ * Please see the LICENSE included with this distribution for details.
+ */
+
+#include "HAL/detail/JSMappedFile.hpp"
+#include "HAL/detail/JSUtil.hpp"
+
+#include <cerrno>
+#include <cstring>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace HAL { namespace detail {
+
+#ifdef _WIN32
+
+  void* MapFile(const std::string& path, std::size_t& byte_length) {
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+      ThrowRuntimeError("JSMappedFile", "Unable to open " + path);
+    }
+
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size)) {
+      CloseHandle(file);
+      ThrowRuntimeError("JSMappedFile", "Unable to get the size of " + path);
+    }
+
+    byte_length = static_cast<std::size_t>(size.QuadPart);
+    if (byte_length == 0) {
+      CloseHandle(file);
+      return nullptr;
+    }
+
+    // PAGE_WRITECOPY and FILE_MAP_COPY make the view copy-on-write.
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+    CloseHandle(file);
+    if (!mapping) {
+      ThrowRuntimeError("JSMappedFile", "Unable to map " + path);
+    }
+
+    // The view keeps the mapping alive.
+    void* bytes = MapViewOfFile(mapping, FILE_MAP_COPY, 0, 0, 0);
+    CloseHandle(mapping);
+    if (!bytes) {
+      ThrowRuntimeError("JSMappedFile", "Unable to map " + path);
+    }
+
+    return bytes;
+  }
+
+  void UnmapFile(void* bytes, std::size_t byte_length) HAL_NOEXCEPT {
+    if (bytes) {
+      UnmapViewOfFile(bytes);
+    }
+  }
+
+#else
+
+  void* MapFile(const std::string& path, std::size_t& byte_length) {
+    int file_descriptor = -1;
+    do {
+      file_descriptor = ::open(path.c_str(), O_RDONLY);
+    } while (file_descriptor < 0 && errno == EINTR);
+    if (file_descriptor < 0) {
+      ThrowRuntimeError("JSMappedFile", "Unable to open " + path + ": " + std::strerror(errno));
+    }
+
+    struct stat file_status;
+    if (::fstat(file_descriptor, &file_status) != 0) {
+      const int error = errno;
+      ::close(file_descriptor);
+      ThrowRuntimeError("JSMappedFile", "Unable to get the size of " + path + ": " + std::strerror(error));
+    }
+
+    byte_length = static_cast<std::size_t>(file_status.st_size);
+    if (byte_length == 0) {
+      ::close(file_descriptor);
+      return nullptr;
+    }
+
+    // MAP_PRIVATE with PROT_WRITE makes the mapping copy-on-write.
+    void* bytes = ::mmap(nullptr, byte_length, PROT_READ | PROT_WRITE, MAP_PRIVATE, file_descriptor, 0);
+    const int error = errno;
+
+    // The mapping stays valid after the file is closed.
+    ::close(file_descriptor);
+    if (bytes == MAP_FAILED) {
+      ThrowRuntimeError("JSMappedFile", "Unable to map " + path + ": " + std::strerror(error));
+    }
+
+    return bytes;
+  }
+
+  void UnmapFile(void* bytes, std::size_t byte_length) HAL_NOEXCEPT {
+    if (bytes) {
+      ::munmap(bytes, byte_length);
+    }
+  }
+
+#endif
+
+}} // namespace HAL { namespace detail {
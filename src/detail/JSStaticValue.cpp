@@ -22,7 +22,7 @@ namespace HAL { namespace detail {
       ThrowInvalidArgument("JSStaticValue", "Both get_callback and set_callback are missing. At least one callback must be provided");
     }
     
-    if (attributes__.find(JSPropertyAttribute::ReadOnly) != attributes__.end()) {
+    if (attributes__.count(JSPropertyAttribute::ReadOnly)) {
       if (!get_callback__) {
         ThrowInvalidArgument("JSStaticValue", "ReadOnly attribute is set but get_callback is missing");
       }
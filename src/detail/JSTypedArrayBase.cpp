@@ -0,0 +1,102 @@
+/**
+ * HAL
+ *
+ * Copyright (c) 2014 by Appcelerator, Inc. All Rights Reserved.
+ * Licensed under the terms of the Apache Public License.
+ * Please see the LICENSE included with this distribution for details.
+ */
+
+#include "HAL/detail/JSTypedArrayBase.hpp"
+#include "HAL/JSValue.hpp"
+#include "HAL/detail/JSUtil.hpp"
+
+#include <cassert>
+#include <memory>
+
+namespace HAL { namespace detail {
+
+  JSTypedArrayBase::JSTypedArrayBase(const JSContext& js_context, JSObjectRef js_object_ref, JSTypedArrayType js_typed_array_type)
+  : JSObject(js_context, js_object_ref) {
+    JSValueRef exception { nullptr };
+    const auto type = JSValueGetTypedArrayType(static_cast<JSContextRef>(js_context), js_object_ref, &exception);
+    if (exception || type != js_typed_array_type) {
+      ThrowInvalidArgument("JSTypedArray", "This JavaScript object is not a typed array of the requested element type.");
+    }
+  }
+
+  std::size_t JSTypedArrayBase::GetLength() const HAL_NOEXCEPT {
+    return JSObjectGetTypedArrayLength(static_cast<JSContextRef>(get_context()), static_cast<JSObjectRef>(*this), nullptr);
+  }
+
+  std::size_t JSTypedArrayBase::GetByteLength() const HAL_NOEXCEPT {
+    return JSObjectGetTypedArrayByteLength(static_cast<JSContextRef>(get_context()), static_cast<JSObjectRef>(*this), nullptr);
+  }
+
+  std::size_t JSTypedArrayBase::GetByteOffset() const HAL_NOEXCEPT {
+    return JSObjectGetTypedArrayByteOffset(static_cast<JSContextRef>(get_context()), static_cast<JSObjectRef>(*this), nullptr);
+  }
+
+  JSArrayBuffer JSTypedArrayBase::GetBuffer() const {
+    const auto js_context = get_context();
+    JSValueRef exception { nullptr };
+    JSObjectRef js_object_ref = JSObjectGetTypedArrayBuffer(static_cast<JSContextRef>(js_context), static_cast<JSObjectRef>(*this), &exception);
+    if (exception) {
+      // If this assert fails then we need to JSValueUnprotect
+      // js_object_ref.
+      assert(!js_object_ref);
+      ThrowRuntimeError("JSTypedArray", JSValue(js_context, exception));
+    }
+
+    return JSArrayBuffer(js_context, js_object_ref);
+  }
+
+  void* JSTypedArrayBase::GetBytesPtr() const HAL_NOEXCEPT {
+    // Unlike JSObjectGetArrayBufferBytesPtr, this already accounts for
+    // the byte offset.
+    return JSObjectGetTypedArrayBytesPtr(static_cast<JSContextRef>(get_context()), static_cast<JSObjectRef>(*this), nullptr);
+  }
+
+  JSObjectRef JSTypedArrayBase::MakeTypedArray(const JSContext& js_context, JSTypedArrayType js_typed_array_type, std::size_t length) {
+    JSValueRef exception { nullptr };
+    JSObjectRef js_object_ref = JSObjectMakeTypedArray(static_cast<JSContextRef>(js_context), js_typed_array_type, length, &exception);
+    if (exception) {
+      // If this assert fails then we need to JSValueUnprotect
+      // js_object_ref.
+      assert(!js_object_ref);
+      ThrowRuntimeError("JSTypedArray", JSValue(js_context, exception));
+    }
+
+    return js_object_ref;
+  }
+
+  JSObjectRef JSTypedArrayBase::MakeTypedArray(const JSContext& js_context, JSTypedArrayType js_typed_array_type, void* bytes, std::size_t byte_length, JSBytesDeallocator deallocator) {
+    std::unique_ptr<JSBytesDeallocator> deallocator_context(new JSBytesDeallocator(std::move(deallocator)));
+    JSValueRef exception { nullptr };
+    JSObjectRef js_object_ref = JSObjectMakeTypedArrayWithBytesNoCopy(static_cast<JSContextRef>(js_context), js_typed_array_type, bytes, byte_length, JSArrayBuffer::DeallocateBytes, deallocator_context.get(), &exception);
+    if (exception) {
+      // If this assert fails then we need to JSValueUnprotect
+      // js_object_ref.
+      assert(!js_object_ref);
+      // The caller keeps ownership of bytes.
+      ThrowRuntimeError("JSTypedArray", JSValue(js_context, exception));
+    }
+
+    // JavaScriptCore now owns the deallocator.
+    deallocator_context.release();
+    return js_object_ref;
+  }
+
+  JSObjectRef JSTypedArrayBase::MakeTypedArray(const JSContext& js_context, JSTypedArrayType js_typed_array_type, const JSArrayBuffer& js_array_buffer, std::size_t byte_offset, std::size_t length) {
+    JSValueRef exception { nullptr };
+    JSObjectRef js_object_ref = JSObjectMakeTypedArrayWithArrayBufferAndOffset(static_cast<JSContextRef>(js_context), js_typed_array_type, static_cast<JSObjectRef>(js_array_buffer), byte_offset, length, &exception);
+    if (exception) {
+      // If this assert fails then we need to JSValueUnprotect
+      // js_object_ref.
+      assert(!js_object_ref);
+      ThrowRuntimeError("JSTypedArray", JSValue(js_context, exception));
+    }
+
+    return js_object_ref;
+  }
+
+}} // namespace HAL { namespace detail {
@@ -22,12 +22,77 @@
 
 namespace HAL { namespace detail {
 
-  js_runtime_error::js_runtime_error(const JSError& js_error) : std::runtime_error(js_error.message()) {
-    js_name__       = js_error.name();
-    js_filename__   = js_error.filename();
-    js_linenumber__ = js_error.linenumber();
-    js_stack__      = js_error.stack();
-    js_message__    = js_error.message();
+  // Return the named property of a thrown JavaScript value converted
+  // to a string, or default_value if the thrown value is not an object
+  // that has the property.
+  static std::string GetExceptionProperty(const JSValue& js_value, const char* property_name, const std::string& default_value) {
+    if (js_value.IsObject()) {
+      const auto js_object = static_cast<JSObject>(js_value);
+      if (js_object.HasProperty(property_name)) {
+        return static_cast<std::string>(js_object.GetProperty(property_name));
+      }
+    }
+    return default_value;
+  }
+  
+  js_runtime_error::js_runtime_error(const JSValue& js_value, const std::string& source_url, int line_number)
+  : std::runtime_error("")
+  , js_value__(js_value)
+  , source_url__(source_url)
+  , line_number__(line_number) {
+  }
+  
+  js_runtime_error::js_runtime_error(const JSError& js_error)
+  : js_runtime_error(static_cast<JSValue>(js_error)) {
+  }
+  
+  const char* js_runtime_error::what() const HAL_NOEXCEPT {
+    if (!what_materialized__) {
+      try {
+        what__ = js_message();
+      } catch (...) {
+        what__ = "Unknown JavaScript exception";
+      }
+      what_materialized__ = true;
+    }
+    return what__.c_str();
+  }
+  
+  std::string js_runtime_error::js_name() const {
+    return GetExceptionProperty(js_value__, "name", "");
+  }
+  
+  std::string js_runtime_error::js_message() const {
+    // A thrown value that isn't an error object (e.g. 'throw "foo"')
+    // is its own message.
+    if (js_value__.IsObject()) {
+      const auto js_object = static_cast<JSObject>(js_value__);
+      if (js_object.HasProperty("message")) {
+        return static_cast<std::string>(js_object.GetProperty("message"));
+      }
+    }
+    return to_string(js_value__);
+  }
+  
+  std::string js_runtime_error::js_filename() const {
+    return GetExceptionProperty(js_value__, "fileName", source_url__);
+  }
+  
+  std::uint32_t js_runtime_error::js_linenumber() const {
+    if (js_value__.IsObject()) {
+      const auto js_object = static_cast<JSObject>(js_value__);
+      if (js_object.HasProperty("lineNumber")) {
+        return static_cast<std::uint32_t>(js_object.GetProperty("lineNumber"));
+      }
+    }
+    return line_number__;
+  }
+  
+  std::vector<JSValue> js_runtime_error::js_stack() const {
+    if (js_value__.IsObject()) {
+      return static_cast<JSError>(static_cast<JSObject>(js_value__)).stack();
+    }
+    return std::vector<JSValue>();
   }
 
   void ThrowRuntimeError(const std::string& internal_component_name, const std::string& message) {
@@ -36,28 +101,10 @@ namespace HAL { namespace detail {
   }
   
   void ThrowRuntimeError(const std::string& internal_component_name, const JSValue& exception, const std::string& source_url, int line_number) {
-    // Check if exception is an error object
-    if (exception.IsObject()) {
-      const auto js_exception = static_cast<JSObject>(exception);
-      if (js_exception.IsError()) {
-        const auto js_context = js_exception.get_context();
-        auto js_error = static_cast<JSError>(js_exception);
-				
-        // Mozilla-like detailed properties to help debug
-        if (!js_error.HasProperty("fileName")) {
-            js_error.SetProperty("fileName", js_context.CreateString(source_url));
-        }
-        if (!js_error.HasProperty("lineNumber")) {
-          js_error.SetProperty("lineNumber", js_context.CreateNumber(line_number));
-        }	
-	
-        throw js_runtime_error(js_error);
-      }
-    }
-
-    const auto exception_message = to_string(exception);
-    HAL_LOG_ERROR(internal_component_name, ": ", exception_message);
-    throw std::runtime_error(exception_message);
+    // Don't inspect the exception here: its details are only read if
+    // the caller asks for them.
+    HAL_LOG_ERROR(internal_component_name, ": JavaScript exception");
+    throw js_runtime_error(exception, source_url, line_number);
   }
   
   void ThrowInvalidArgument(const std::string& internal_component_name, const std::string& message) {
@@ -101,38 +148,19 @@ namespace HAL { namespace detail {
     return js_string_ref_vector;
   }
   
-  JSPropertyAttributes ToJSPropertyAttributes(const std::unordered_set<JSPropertyAttribute>& attributes) HAL_NOEXCEPT {
-    JSPropertyAttributes result = kJSPropertyAttributeNone;
-    for (auto attribute : attributes) {
-      switch (attribute) {
-        case JSPropertyAttribute::None:
-          result |= kJSPropertyAttributeNone;
-          break;
-          
-        case JSPropertyAttribute::ReadOnly:
-          result |= kJSPropertyAttributeReadOnly;
-          break;
-          
-        case JSPropertyAttribute::DontEnum:
-          result |= kJSPropertyAttributeDontEnum;
-          break;
-          
-        case JSPropertyAttribute::DontDelete:
-          result |= kJSPropertyAttributeDontDelete;
-          break;
-      }
-    }
-    
-    return result;
+#ifdef HAL_CONSTEXPR_ENABLE
+  static_assert(kJSPropertyAttributeReadOnly   == JSPropertyAttributeSet(JSPropertyAttribute::ReadOnly).get_bits()   &&
+                kJSPropertyAttributeDontEnum   == JSPropertyAttributeSet(JSPropertyAttribute::DontEnum).get_bits()   &&
+                kJSPropertyAttributeDontDelete == JSPropertyAttributeSet(JSPropertyAttribute::DontDelete).get_bits(),
+                "JSPropertyAttributeSet bits must match the JavaScriptCore C API's JSPropertyAttributes");
+#endif
+  
+  JSPropertyAttributes ToJSPropertyAttributes(JSPropertyAttributeSet attributes) HAL_NOEXCEPT {
+    return attributes.get_bits();
   }
   
-  std::unordered_set<JSPropertyAttribute> FromJSPropertyAttributes(::JSPropertyAttributes attributes) HAL_NOEXCEPT {
-    std::unordered_set<JSPropertyAttribute> attribute_set;
-    static_cast<void>(attributes == kJSPropertyAttributeNone       && attribute_set.emplace(JSPropertyAttribute::None).second);
-    static_cast<void>(attributes &  kJSPropertyAttributeReadOnly   && attribute_set.emplace(JSPropertyAttribute::ReadOnly).second);
-    static_cast<void>(attributes &  kJSPropertyAttributeDontEnum   && attribute_set.emplace(JSPropertyAttribute::DontEnum).second);
-    static_cast<void>(attributes &  kJSPropertyAttributeDontDelete && attribute_set.emplace(JSPropertyAttribute::DontDelete).second);
-    return attribute_set;
+  JSPropertyAttributeSet FromJSPropertyAttributes(::JSPropertyAttributes attributes) HAL_NOEXCEPT {
+    return JSPropertyAttributeSet::FromBits(attributes);
   }
   
   std::string to_string(JSPropertyAttribute attribute) HAL_NOEXCEPT {
@@ -158,15 +186,14 @@ namespace HAL { namespace detail {
     return string;
   }
   
-  std::string to_string(const std::unordered_set<JSPropertyAttribute>& attributes) HAL_NOEXCEPT {
+  std::string to_string(JSPropertyAttributeSet attributes) HAL_NOEXCEPT {
     std::string result;
     for (auto attribute : {JSPropertyAttribute::None, JSPropertyAttribute::ReadOnly, JSPropertyAttribute::DontEnum, JSPropertyAttribute::DontDelete}) {
-      auto position = attributes.find(attribute);
-      if (position != attributes.end()) {
+      if (attributes.count(attribute)) {
         if (!result.empty()) {
           result += ", ";
         }
-        result += to_string(*position);
+        result += to_string(attribute);
       }
     }
     
@@ -327,4 +354,40 @@ namespace HAL { namespace detail {
     return bits < 0 ? -result : result;
   }
   
+  bool ToArrayIndex(JSStringRef property_name_ref, unsigned& index) HAL_NOEXCEPT {
+    const std::size_t length = JSStringGetLength(property_name_ref);
+    
+    // 4294967294 has 10 digits.
+    if (length == 0 || length > 10) {
+      return false;
+    }
+    
+    const JSChar* characters = JSStringGetCharactersPtr(property_name_ref);
+    
+    // Leading zeros are not canonical, e.g. "01" is not an index.
+    if (characters[0] == '0') {
+      if (length > 1) {
+        return false;
+      }
+      index = 0;
+      return true;
+    }
+    
+    std::uint64_t value = 0;
+    for (std::size_t i = 0; i < length; ++i) {
+      const JSChar c = characters[i];
+      if (c < '0' || c > '9') {
+        return false;
+      }
+      value = value * 10 + (c - '0');
+    }
+    
+    if (value >= 4294967295ULL) {
+      return false;
+    }
+    
+    index = static_cast<unsigned>(value);
+    return true;
+  }
+  
 }} // namespace HAL { namespace detail {
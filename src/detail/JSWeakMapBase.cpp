@@ -0,0 +1,144 @@
+/**
+ * HAL
+ *
+ * Copyright (c) 2014 by Appcelerator, Inc. All Rights Reserved.
+ * Licensed under the terms of the Apache Public License.
+ * Please see the LICENSE included with this distribution for details.
+ */
+
+#include "HAL/detail/JSWeakMapBase.hpp"
+
+#include "HAL/JSContext.hpp"
+#include "HAL/JSObject.hpp"
+#include "HAL/JSValue.hpp"
+#include "HAL/detail/JSUtil.hpp"
+
+#include <atomic>
+#include <string>
+
+namespace HAL { namespace detail {
+
+  // The private data of a sentinel object.
+  struct JSWeakMapSentinel {
+    std::weak_ptr<JSWeakMapBase> table;
+    std::intptr_t                key;
+  };
+
+  static std::string CreateSentinelPropertyName() {
+    static std::atomic<std::uint64_t> next_id { 0 };
+    return "__HAL_JSWeakMap_" + std::to_string(next_id++);
+  }
+
+  JSWeakMapBase::JSWeakMapBase()
+  : property_name__(CreateSentinelPropertyName()) {
+  }
+
+  JSWeakMapBase::~JSWeakMapBase() HAL_NOEXCEPT {
+  }
+
+  std::intptr_t JSWeakMapBase::GetKey(const JSObject& js_object) HAL_NOEXCEPT {
+    return reinterpret_cast<std::intptr_t>(static_cast<JSObjectRef>(js_object));
+  }
+
+  JSClassRef JSWeakMapBase::GetSentinelClass() HAL_NOEXCEPT {
+    // The sentinel class is created once and deliberately never
+    // released.
+    static JSClassRef js_class_ref = [] {
+      ::JSClassDefinition js_class_definition = kJSClassDefinitionEmpty;
+      js_class_definition.className = "JSWeakMapSentinel";
+      js_class_definition.finalize  = JSWeakMapBase::FinalizeSentinel;
+      return JSClassCreate(&js_class_definition);
+    }();
+    return js_class_ref;
+  }
+
+  void JSWeakMapBase::FinalizeSentinel(JSObjectRef js_object_ref) {
+    auto sentinel = static_cast<JSWeakMapSentinel*>(JSObjectGetPrivate(js_object_ref));
+    if (!sentinel) {
+      return;
+    }
+
+    // Only act if the table still exists and this sentinel is still
+    // the one it knows for the key.
+    auto table = sentinel -> table.lock();
+    if (table) {
+      const auto position = table -> sentinels__.find(sentinel -> key);
+      if (position != table -> sentinels__.end() && position -> second == js_object_ref) {
+        HAL_LOG_DEBUG("JSWeakMap: finalize key ", sentinel -> key);
+        table -> sentinels__.erase(position);
+        table -> Finalize(sentinel -> key);
+      }
+    }
+
+    JSObjectSetPrivate(js_object_ref, nullptr);
+    delete sentinel;
+  }
+
+  bool JSWeakMapBase::IsAttached(const JSObject& js_object) {
+    const auto key      = GetKey(js_object);
+    const auto position = sentinels__.find(key);
+    if (position == sentinels__.end()) {
+      return false;
+    }
+
+    const auto js_context_ref = static_cast<JSContextRef>(js_object.get_context());
+    JSValueRef exception { nullptr };
+    JSValueRef js_value_ref = JSObjectGetProperty(js_context_ref, static_cast<JSObjectRef>(js_object), static_cast<JSStringRef>(property_name__), &exception);
+    if (!exception && js_value_ref == position -> second) {
+      return true;
+    }
+
+    // The object that owned this entry is gone and its address has
+    // been reused, or the sentinel property was removed by script.
+    HAL_LOG_DEBUG("JSWeakMap: drop stale key ", key);
+    sentinels__.erase(position);
+    Finalize(key);
+    return false;
+  }
+
+  std::intptr_t JSWeakMapBase::Attach(const JSObject& js_object) {
+    const auto key = GetKey(js_object);
+    if (IsAttached(js_object)) {
+      return key;
+    }
+
+    const auto js_context_ref = static_cast<JSContextRef>(js_object.get_context());
+    const auto js_object_ref  = static_cast<JSObjectRef>(js_object);
+
+    auto sentinel = new JSWeakMapSentinel { shared_from_this(), key };
+    JSObjectRef sentinel_ref = JSObjectMake(js_context_ref, GetSentinelClass(), sentinel);
+
+    JSValueRef exception { nullptr };
+    JSObjectSetProperty(js_context_ref, js_object_ref, static_cast<JSStringRef>(property_name__), sentinel_ref, kJSPropertyAttributeDontEnum, &exception);
+    if (exception) {
+      // The sentinel is garbage now, so make its finalizer a no-op.
+      sentinel -> table.reset();
+      ThrowRuntimeError("JSWeakMap", JSValue(js_object.get_context(), exception));
+    }
+
+    // Non-extensible objects silently ignore the new property.
+    JSValueRef js_value_ref = JSObjectGetProperty(js_context_ref, js_object_ref, static_cast<JSStringRef>(property_name__), &exception);
+    if (exception || js_value_ref != sentinel_ref) {
+      sentinel -> table.reset();
+      ThrowInvalidArgument("JSWeakMap", "Unable to use a JavaScript object that does not accept new properties as a key");
+    }
+
+    sentinels__[key] = sentinel_ref;
+    return key;
+  }
+
+  bool JSWeakMapBase::Detach(const JSObject& js_object) {
+    if (!IsAttached(js_object)) {
+      return false;
+    }
+
+    sentinels__.erase(GetKey(js_object));
+    JSObjectDeleteProperty(static_cast<JSContextRef>(js_object.get_context()), static_cast<JSObjectRef>(js_object), static_cast<JSStringRef>(property_name__), nullptr);
+    return true;
+  }
+
+  void JSWeakMapBase::DetachAll() HAL_NOEXCEPT {
+    sentinels__.clear();
+  }
+
+}} // namespace HAL { namespace detail {
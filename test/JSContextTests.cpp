@@ -48,6 +48,32 @@ TEST_F(JSContextTests, JSEvaluateScriptWithError) {
   }
 }
 
+TEST_F(JSContextTests, JSEvaluateScriptWithLazyError) {
+  JSContext js_context = js_context_group.CreateContext();
+  js_context.JSEvaluateScript("var error = new TypeError('bad type');");
+  try {
+    js_context.JSEvaluateScript("throw error;", js_context.get_global_object(), "lazy.js", 7);
+    XCTAssertTrue(false);
+  } catch (const HAL::detail::js_runtime_error& e) {
+    // Throwing doesn't write the details back onto the error object.
+    XCTAssertFalse(static_cast<JSObject>(e.js_value()).HasProperty("fileName"));
+    XCTAssertEqual("TypeError", e.js_name());
+    XCTAssertEqual("bad type", e.js_message());
+    XCTAssertEqual("bad type", std::string(e.what()));
+    XCTAssertEqual("lazy.js", e.js_filename());
+    XCTAssertEqual(7, e.js_linenumber());
+  }
+  
+  try {
+    js_context.JSEvaluateScript("throw 'not an error';");
+    XCTAssertTrue(false);
+  } catch (const HAL::detail::js_runtime_error& e) {
+    XCTAssertEqual("", e.js_name());
+    XCTAssertEqual("not an error", std::string(e.what()));
+    XCTAssertEqual(0, e.js_stack().size());
+  }
+}
+
 TEST_F(JSContextTests, JSContext) {
   JSContext js_context_1 = js_context_group.CreateContext();
   JSContext js_context_2 = js_context_group.CreateContext();
@@ -88,3 +114,119 @@ TEST_F(JSContextTests, JSContext) {
   JSContext js_context_12 = js_context_7;
   XCTAssertEqual(js_context_7, js_context_12);
 }
+
+TEST_F(JSContextTests, CachedValues) {
+  JSContext js_context = js_context_group.CreateContext();
+  
+  // The same preallocated values are returned every time, including
+  // through copies of the JSContext.
+  JSContext js_context_copy = js_context;
+  XCTAssertEqual(&js_context.get_undefined(), &js_context_copy.get_undefined());
+  XCTAssertEqual(&js_context.get_null()     , &js_context.get_null());
+  XCTAssertEqual(&js_context.get_boolean(true), &js_context.get_boolean(true));
+  XCTAssertNotEqual(&js_context.get_boolean(true), &js_context.get_boolean(false));
+  
+  XCTAssertTrue(js_context.get_undefined().IsUndefined());
+  XCTAssertTrue(js_context.get_null().IsNull());
+  XCTAssertTrue(static_cast<bool>(js_context.get_boolean(true)));
+  XCTAssertFalse(static_cast<bool>(js_context.get_boolean(false)));
+  
+  XCTAssertTrue(js_context.IsCachedNumber(-1));
+  XCTAssertTrue(js_context.IsCachedNumber(255));
+  XCTAssertFalse(js_context.IsCachedNumber(256));
+  XCTAssertEqual(42, static_cast<int32_t>(js_context.get_number(42)));
+  XCTAssertEqual(&js_context.get_number(42), &js_context_copy.get_number(42));
+  ASSERT_THROW(js_context.get_number(256), std::invalid_argument);
+  
+  XCTAssertEqual(7, static_cast<int32_t>(js_context.CreateNumber(7)));
+  XCTAssertEqual(1000, static_cast<int32_t>(js_context.CreateNumber(1000)));
+  XCTAssertEqual(js_context.get_undefined(), js_context.CreateUndefined());
+  
+  // Each execution context has its own values.
+  JSContext js_context_2 = js_context_group.CreateContext();
+  XCTAssertNotEqual(&js_context.get_undefined(), &js_context_2.get_undefined());
+  XCTAssertEqual(js_context_2, js_context_2.get_null().get_context());
+  
+  // The range only applies to execution contexts whose small integers
+  // have not been created yet.
+  JSContext::SetCachedNumberRange(0, 1023);
+  JSContext js_context_3 = js_context_group.CreateContext();
+  XCTAssertTrue(js_context_3.IsCachedNumber(1000));
+  XCTAssertEqual(1000, static_cast<int32_t>(js_context_3.get_number(1000)));
+  XCTAssertFalse(js_context.IsCachedNumber(1000));
+  JSContext::SetCachedNumberRange(-1, 255);
+}
+
+TEST_F(JSContextTests, CachedBuiltins) {
+  JSContext js_context = js_context_group.CreateContext();
+  auto global_object = js_context.get_global_object();
+  XCTAssertEqual(global_object, js_context.get_global_object());
+  
+  const auto js_array = static_cast<JSObject>(js_context.JSEvaluateScript("[1, 2, 3]"));
+  const auto js_error = static_cast<JSObject>(js_context.JSEvaluateScript("new TypeError('oops')"));
+  XCTAssertTrue(js_array.IsArray());
+  XCTAssertFalse(js_error.IsArray());
+  XCTAssertTrue(js_error.IsError());
+  XCTAssertFalse(js_array.IsError());
+  
+  // Replacing the builtins from a script doesn't affect the brand
+  // checks.
+  js_context.JSEvaluateScript("Array.isArray = function() { return false; }; Error = function() {};");
+  XCTAssertTrue(js_array.IsArray());
+  XCTAssertTrue(js_error.IsError());
+  
+  // Each execution context caches its own builtins.
+  JSContext js_context_2 = js_context_group.CreateContext();
+  XCTAssertTrue(static_cast<JSObject>(js_context_2.JSEvaluateScript("new Error('other')")).IsError());
+}
+
+TEST_F(JSContextTests, CreateIterable) {
+  JSContext js_context = js_context_group.CreateContext();
+  auto global_object = js_context.get_global_object();
+  
+  // A generator that would be too large to materialize, consumed in
+  // chunks of 10.
+  int produced = 0;
+  auto js_counter = js_context.CreateIterable([&produced](const JSContext& js_context, std::size_t max_count) {
+      std::vector<int> chunk;
+      for (std::size_t i = 0; i < max_count; ++i) {
+        chunk.push_back(produced++);
+      }
+      return js_context.CreateArray(chunk);
+    }, 10);
+  global_object.SetProperty("counter", js_counter);
+  
+  XCTAssertEqual(0, static_cast<int32_t>(js_context.JSEvaluateScript("counter.next().value")));
+  XCTAssertEqual(10, produced);
+  XCTAssertEqual(45, static_cast<int32_t>(js_context.JSEvaluateScript("var sum = 0; for (var i = 0; i < 9; ++i) { sum += counter.next().value; } sum")));
+  XCTAssertEqual(10, produced);
+  XCTAssertEqual(10, static_cast<int32_t>(js_context.JSEvaluateScript("counter.next().value")));
+  XCTAssertEqual(20, produced);
+  
+  // A native range, read lazily and ended by an empty chunk.
+  const std::vector<std::string> names { "a", "b", "c" };
+  global_object.SetProperty("names", js_context.CreateIterable(names.begin(), names.end(), 2));
+  XCTAssertEqual("a,b,c", static_cast<std::string>(js_context.JSEvaluateScript("var s = []; for (var r = names.next(); !r.done; r = names.next()) { s.push(r.value); } s.join()")));
+  XCTAssertTrue(static_cast<bool>(js_context.JSEvaluateScript("names.next().done")));
+  
+  ASSERT_THROW(js_context.CreateIterable(names.begin(), names.end(), 0), std::invalid_argument);
+}
+
+TEST_F(JSContextTests, SharedJSClass) {
+  JSContext js_context = js_context_group.CreateContext();
+  
+  // Plain objects share the process-wide empty class.
+  const JSClass& empty_class = JSClass::get_empty();
+  XCTAssertEqual(&empty_class, &JSClass::get_empty());
+  XCTAssertEqual("Empty", empty_class.get_name());
+  XCTAssertTrue(static_cast<JSValue>(js_context.CreateObject()).IsObjectOfClass(empty_class));
+  
+  // Equal definitions share one class, so an object of one is an
+  // object of the other.
+  const JSClass js_class_1;
+  const JSClass js_class_2;
+  XCTAssertTrue(static_cast<JSValue>(js_context.CreateObject(js_class_1)).IsObjectOfClass(js_class_2));
+  
+  // JSExport classes are returned by reference.
+  XCTAssertEqual(&JSExport<JSExportObject>::Class(), &JSExport<JSExportObject>::Class());
+}
@@ -10,7 +10,11 @@
 #include "Widget.hpp"
 #include "ChildWidget.hpp"
 #include "OtherWidget.hpp"
+#include <algorithm>
 #include <functional>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
 
 #include "gtest/gtest.h"
 
@@ -21,6 +25,126 @@
 
 using namespace HAL;
 
+namespace {
+  
+  // Names that are prefixes of each other, more of them than there
+  // are index thunks, so that some are dispatched by name.
+  std::vector<std::string> ManyValuePropertyNames() {
+    std::vector<std::string> names { "v", "w", "w0", "wx", "wxy" };
+    for (int i = 0; i < 64; ++i) {
+      names.push_back("v" + std::string(i < 10 ? "0" : "") + std::to_string(i));
+    }
+    return names;
+  }
+  
+  class ManyValueProperties : public JSExportObject, public JSExport<ManyValueProperties> {
+  public:
+    
+    ManyValueProperties(const JSContext& js_context) HAL_NOEXCEPT
+    : JSExportObject(js_context) {
+    }
+    
+    static void JSExportInitialize() {
+      JSExport<ManyValueProperties>::SetClassVersion(1);
+      JSExport<ManyValueProperties>::SetParent(JSExport<JSExportObject>::Class());
+      for (const auto& name : ManyValuePropertyNames()) {
+        JSExport<ManyValueProperties>::AddValueProperty(name,
+            [name](const ManyValueProperties& object) -> JSValue {
+              const auto position = object.values.find(name);
+              return object.get_context().CreateString(position == object.values.end() ? "" : position -> second);
+            },
+            [name](ManyValueProperties& object, const JSValue& value) -> bool {
+              object.values[name] = static_cast<std::string>(value);
+              return true;
+            });
+      }
+    }
+    
+    std::unordered_map<std::string, std::string> values;
+  };
+  
+  // A class whose JSClass is only created from a definition that a
+  // test builds, so that building it doesn't replace the definition
+  // behind a class that other tests use.
+  class MemberThunks : public JSExportObject, public JSExport<MemberThunks> {
+  public:
+    
+    MemberThunks(const JSContext& js_context) HAL_NOEXCEPT
+    : JSExportObject(js_context) {
+    }
+    
+    static void JSExportInitialize() {
+      JSExport<MemberThunks>::SetClassVersion(1);
+    }
+    
+    JSValue js_get_name() const {
+      return get_context().CreateString(name);
+    }
+    
+    bool js_set_name(const JSValue& value) {
+      name = static_cast<std::string>(value);
+      return true;
+    }
+    
+    JSValue js_get_pi() const {
+      return get_context().CreateNumber(3.141592653589793);
+    }
+    
+    JSValue js_sayHello(const std::vector<JSValue>&, JSObject&) {
+      return get_context().CreateString("Hello, " + name);
+    }
+    
+    std::string name { "world" };
+  };
+  
+  // A pooled class that is the parent of another JSExport class.
+  class PooledParent : public JSExportObject, public JSExport<PooledParent> {
+  public:
+    
+    PooledParent(const JSContext& js_context) HAL_NOEXCEPT
+    : JSExportObject(js_context) {
+      ++live_count;
+    }
+    
+    virtual ~PooledParent() HAL_NOEXCEPT {
+      --live_count;
+    }
+    
+    static void JSExportInitialize() {
+      JSExport<PooledParent>::SetClassVersion(1);
+      JSExport<PooledParent>::SetParent(JSExport<JSExportObject>::Class());
+    }
+    
+    static int live_count;
+  };
+  
+  int PooledParent::live_count = 0;
+  
+} // namespace {
+
+namespace HAL {
+  template<>
+  struct JSExportAllocator<PooledParent> : JSExportPoolAllocator<PooledParent, 8> {
+  };
+}
+
+namespace {
+  
+  class PooledChild : public PooledParent, public JSExport<PooledChild> {
+  public:
+    
+    PooledChild(const JSContext& js_context) HAL_NOEXCEPT
+    : PooledParent(js_context) {
+    }
+    
+    static void JSExportInitialize() {
+      JSExport<PooledChild>::SetClassVersion(1);
+      JSExport<PooledChild>::SetParent(JSExport<PooledParent>::Class());
+    }
+  };
+  
+} // namespace {
+
 class JSExportTests : public testing::Test {
  protected:
   virtual void SetUp() {
@@ -74,6 +198,305 @@ TEST_F(JSExportTests, JSExportClassDefinitionBuilder) {
   auto native_class = builder.build();
 }
 
+TEST_F(JSExportTests, JSExportClassDefinitionBuilderMemberThunks) {
+  detail::JSExportClassDefinitionBuilder<MemberThunks> builder("MemberThunks");
+  builder
+      .AddValueProperty<&MemberThunks::js_get_name, &MemberThunks::js_set_name>("name")
+      .AddValueProperty<&MemberThunks::js_get_pi>("pi", false)
+      .AddFunctionProperty<&MemberThunks::js_sayHello>("sayHello");
+  
+  const detail::JSExportClass<MemberThunks> js_class(builder.build());
+  
+  JSContext js_context = js_context_group.CreateContext();
+  JSObject global_object = js_context.get_global_object();
+  JSObject object = js_context.CreateObject(js_class);
+  global_object.SetProperty("object", object);
+  
+  XCTAssertEqual("world", static_cast<std::string>(object.GetProperty("name")));
+  object.SetProperty("name", js_context.CreateString("foo"));
+  XCTAssertEqual("foo", static_cast<std::string>(object.GetProperty("name")));
+  XCTAssertEqual("foo", object.GetPrivate<MemberThunks>() -> name);
+  
+  XCTAssertEqual(3.141592653589793, static_cast<double>(object.GetProperty("pi")));
+  
+  // "pi" has no setter and isn't enumerable.
+  js_context.JSEvaluateScript("object.pi = 3;");
+  XCTAssertEqual(3.141592653589793, static_cast<double>(object.GetProperty("pi")));
+  XCTAssertFalse(static_cast<bool>(js_context.JSEvaluateScript("var found = false; for (var key in object) { found = found || key === 'pi'; } found")));
+  
+  XCTAssertEqual("Hello, foo", static_cast<std::string>(js_context.JSEvaluateScript("object.sayHello();")));
+}
+
+TEST_F(JSExportTests, IndexedValuePropertyThunks) {
+  JSContext js_context = js_context_group.CreateContext();
+  JSObject global_object = js_context.get_global_object();
+  JSObject widget = js_context.CreateObject(JSExport<Widget>::Class());
+  global_object.SetProperty("widget", widget);
+  
+  // "value" is a std::function property, which JavaScriptCore reaches
+  // through the thunk for its index.
+  js_context.JSEvaluateScript("widget.value = 'foo';");
+  XCTAssertEqual("foo", static_cast<std::string>(js_context.JSEvaluateScript("widget.value;")));
+  XCTAssertEqual("world", static_cast<std::string>(js_context.JSEvaluateScript("widget.name;")));
+  XCTAssertEqual(42, static_cast<int32_t>(js_context.JSEvaluateScript("widget.number;")));
+  XCTAssertTrue(static_cast<bool>(js_context.JSEvaluateScript("widget.pi > 3.14 && widget.pi < 3.15;")));
+  
+  // The first kNamedValuePropertyThunkCount properties in UTF-16 name
+  // order each get their own thunk, and the rest share the callback
+  // that searches for the name.
+  const auto names = ManyValuePropertyNames();
+  detail::JSExportClassDefinitionBuilder<Widget> builder("Widget");
+  for (const auto& name : names) {
+    builder.AddValueProperty(name, std::mem_fn(&Widget::js_get_name), std::mem_fn(&Widget::js_set_name));
+  }
+  const auto definition  = builder.build();
+  const auto thunk_count = detail::JSExportClassDefinition<Widget>::kNamedValuePropertyThunkCount;
+  XCTAssertEqual(names.size(), definition.get_named_value_property_count());
+  XCTAssertTrue(names.size() > thunk_count);
+  
+  std::unordered_set<std::intptr_t> index_thunks;
+  for (std::size_t index = 0; index < thunk_count; ++index) {
+    index_thunks.insert(reinterpret_cast<std::intptr_t>(definition.get_named_value_property_getter(index)));
+  }
+  XCTAssertEqual(thunk_count, index_thunks.size());
+  
+  const auto by_name = definition.get_named_value_property_getter(thunk_count);
+  XCTAssertEqual(0, index_thunks.count(reinterpret_cast<std::intptr_t>(by_name)));
+  for (std::size_t index = thunk_count; index < names.size(); ++index) {
+    XCTAssertTrue(definition.get_named_value_property_getter(index) == by_name);
+  }
+}
+
+TEST_F(JSExportTests, FindNamedValueProperty) {
+  auto names = ManyValuePropertyNames();
+  detail::JSExportClassDefinitionBuilder<Widget> builder("Widget");
+  for (const auto& name : names) {
+    builder.AddValueProperty(name, std::mem_fn(&Widget::js_get_name));
+  }
+  const auto definition = builder.build();
+  
+  // The names are ASCII, so their UTF-16 order is their byte order.
+  std::sort(names.begin(), names.end());
+  const auto find = [&definition](const std::string& name) {
+    JSStringRef js_string_ref = JSStringCreateWithUTF8CString(name.c_str());
+    const auto  index         = definition.FindNamedValueProperty(js_string_ref);
+    JSStringRelease(js_string_ref);
+    return index;
+  };
+  
+  for (std::size_t index = 0; index < names.size(); ++index) {
+    XCTAssertEqual(index, find(names.at(index)));
+  }
+  
+  // Missing names, including prefixes and extensions of the names
+  // above, and names before the first and after the last.
+  for (const auto& name : { "", "a", "u", "vv", "v6", "v630", "w1", "wxyz", "x" }) {
+    XCTAssertEqual(names.size(), find(name));
+  }
+}
+
+TEST_F(JSExportTests, NamedValuePropertiesBeyondThunks) {
+  JSContext js_context = js_context_group.CreateContext();
+  JSObject global_object = js_context.get_global_object();
+  global_object.SetProperty("many", js_context.CreateObject(JSExport<ManyValueProperties>::Class()));
+  
+  // Give every property its own name as its value, through both
+  // dispatch paths, then read them all back.
+  for (const auto& name : ManyValuePropertyNames()) {
+    js_context.JSEvaluateScript("many['" + name + "'] = '" + name + "';");
+  }
+  for (const auto& name : ManyValuePropertyNames()) {
+    XCTAssertEqual(name, static_cast<std::string>(js_context.JSEvaluateScript("many['" + name + "'];")));
+  }
+  XCTAssertTrue(js_context.JSEvaluateScript("many.wxyz;").IsUndefined());
+}
+
+TEST_F(JSExportTests, DataMemberProperty) {
+  JSContext js_context = js_context_group.CreateContext();
+  JSObject global_object = js_context.get_global_object();
+  JSObject widget = js_context.CreateObject(JSExport<Widget>::Class());
+  global_object.SetProperty("widget", widget);
+  
+  // Widget binds "rawNumber" directly to its int data member.
+  XCTAssertEqual(42, static_cast<int32_t>(widget.GetProperty("rawNumber")));
+  
+  js_context.JSEvaluateScript("widget.rawNumber = 3*7;");
+  XCTAssertEqual(21, widget.GetPrivate<Widget>() -> get_number());
+  
+  // Unlike "number", whose setter rejects anything but a number, the
+  // data member converts the value.
+  js_context.JSEvaluateScript("widget.number = '8';");
+  XCTAssertEqual(21, widget.GetPrivate<Widget>() -> get_number());
+  
+  js_context.JSEvaluateScript("widget.rawNumber = '7';");
+  XCTAssertEqual(7, widget.GetPrivate<Widget>() -> get_number());
+  
+  widget.GetPrivate<Widget>() -> set_number(99);
+  XCTAssertEqual(99, static_cast<int32_t>(js_context.JSEvaluateScript("widget.rawNumber;")));
+  XCTAssertEqual(99, static_cast<int32_t>(js_context.JSEvaluateScript("widget.number;")));
+}
+
+TEST_F(JSExportTests, BorrowedThisObject) {
+  JSContext js_context = js_context_group.CreateContext();
+  JSObject global_object = js_context.get_global_object();
+  JSObject widget = js_context.CreateObject(JSExport<Widget>::Class());
+  global_object.SetProperty("widget", widget);
+  
+  // The callback borrows "this" from JavaScriptCore, and passing it on
+  // to the JavaScript callback copies it into an owning JSObject.
+  js_context.JSEvaluateScript("var self = null; widget.sayHelloWithCallback(function() { self = this; return this.name; });");
+  js_context.GarbageCollect();
+  XCTAssertTrue(static_cast<bool>(js_context.JSEvaluateScript("self === widget;")));
+  XCTAssertEqual("world", static_cast<std::string>(js_context.JSEvaluateScript("self.name;")));
+  
+  for (int i = 0; i < 100; ++i) {
+    js_context.JSEvaluateScript("widget.sayHello();");
+  }
+  js_context.GarbageCollect();
+  XCTAssertEqual("Hello, world. Your number is 42.", static_cast<std::string>(js_context.JSEvaluateScript("widget.sayHello();")));
+  
+  // The error path builds its JSError from borrowed handles too.
+  const std::string script = "var message; try { widget.sum.call({}); } catch (e) { message = e.message; } message;";
+  XCTAssertEqual("this object has no native object", static_cast<std::string>(js_context.JSEvaluateScript(script)));
+  XCTAssertEqual(3, static_cast<int32_t>(js_context.JSEvaluateScript("widget.sum(1, 2);")));
+}
+
+TEST_F(JSExportTests, JSArgumentsView) {
+  JSContext js_context = js_context_group.CreateContext();
+  JSObject global_object = js_context.get_global_object();
+  global_object.SetProperty("widget", js_context.CreateObject(JSExport<Widget>::Class()));
+  
+  XCTAssertEqual(0, static_cast<int32_t>(js_context.JSEvaluateScript("widget.sum();")));
+  XCTAssertEqual(6, static_cast<int32_t>(js_context.JSEvaluateScript("widget.sum(1, 2, 3);")));
+  XCTAssertEqual(7, static_cast<int32_t>(js_context.JSEvaluateScript("widget.sum('3', 4);")));
+  XCTAssertTrue(static_cast<bool>(js_context.JSEvaluateScript("isNaN(widget.sum(1, undefined));")));
+}
+
+TEST_F(JSExportTests, JSExportSlabPool) {
+  detail::JSExportSlabPool pool(24, 8, 4);
+  XCTAssertEqual(24, pool.get_statistics().slot_size);
+  XCTAssertEqual(0, pool.get_statistics().slab_count);
+  
+  std::vector<void*> slots;
+  for (int i = 0; i < 5; ++i) {
+    slots.push_back(pool.Allocate());
+    XCTAssertTrue(pool.Owns(slots.back()));
+  }
+  XCTAssertEqual(2, pool.get_statistics().slab_count);
+  XCTAssertEqual(8, pool.get_statistics().capacity());
+  XCTAssertEqual(5, pool.get_statistics().in_use);
+  
+  // A freed slot is reused before a new slab is allocated.
+  void* slot = slots.back();
+  slots.pop_back();
+  pool.Deallocate(slot);
+  XCTAssertEqual(4, pool.get_statistics().in_use);
+  XCTAssertEqual(slot, pool.Allocate());
+  slots.push_back(slot);
+  XCTAssertEqual(2, pool.get_statistics().slab_count);
+  XCTAssertEqual(6, pool.get_statistics().total_allocations);
+  XCTAssertEqual(5, pool.get_statistics().peak_in_use);
+  
+  int not_pooled = 0;
+  XCTAssertFalse(pool.Owns(&not_pooled));
+  XCTAssertFalse(detail::JSExportSlabPool::DeallocateIfPooled(&not_pooled));
+  for (auto pooled_slot : slots) {
+    XCTAssertTrue(detail::JSExportSlabPool::DeallocateIfPooled(pooled_slot));
+  }
+  XCTAssertEqual(0, pool.get_statistics().in_use);
+}
+
+TEST_F(JSExportTests, JSExportPoolAllocator) {
+  JSContext js_context = js_context_group.CreateContext();
+  const auto before = JSExportAllocator<OtherWidget>::GetStatistics();
+  
+  auto after = before;
+  {
+    std::vector<JSObject> other_widgets;
+    for (int i = 0; i < 100; ++i) {
+      other_widgets.push_back(js_context.CreateObject(JSExport<OtherWidget>::Class()));
+    }
+    
+    after = JSExportAllocator<OtherWidget>::GetStatistics();
+    XCTAssertEqual(before.total_allocations + 100, after.total_allocations);
+    XCTAssertTrue(after.in_use >= 100);
+    XCTAssertTrue(after.capacity() >= after.in_use);
+    XCTAssertTrue(after.peak_in_use >= after.in_use);
+    
+    for (const auto& other_widget : other_widgets) {
+      XCTAssertNotEqual(nullptr, other_widget.GetPrivate<OtherWidget>());
+    }
+  }
+  
+  // Finalizing the objects returns their slots to the pool.
+  js_context.GarbageCollect();
+  const auto released = JSExportAllocator<OtherWidget>::GetStatistics();
+  XCTAssertTrue(released.in_use < after.in_use);
+  XCTAssertEqual(after.slab_count, released.slab_count);
+  XCTAssertEqual(after.peak_in_use, released.peak_in_use);
+  
+  // New objects reuse the freed slots instead of growing the pool.
+  const auto reused_count = after.in_use - released.in_use;
+  std::vector<JSObject> other_widgets;
+  for (std::size_t i = 0; i < reused_count; ++i) {
+    other_widgets.push_back(js_context.CreateObject(JSExport<OtherWidget>::Class()));
+  }
+  
+  const auto reused = JSExportAllocator<OtherWidget>::GetStatistics();
+  XCTAssertEqual(released.slab_count, reused.slab_count);
+  XCTAssertEqual(released.in_use + reused_count, reused.in_use);
+  XCTAssertEqual(released.total_allocations + reused_count, reused.total_allocations);
+}
+
+TEST_F(JSExportTests, DestroyPreviousNativeObjectFromPool) {
+  JSContext js_context = js_context_group.CreateContext();
+  const auto before       = JSExportAllocator<PooledParent>::GetStatistics();
+  const auto before_count = PooledParent::live_count;
+  
+  // JavaScriptCore initializes each PooledChild as a PooledParent
+  // first, and the PooledParent allocated from the pool is then
+  // destroyed and replaced by the PooledChild.
+  std::vector<JSObject> children;
+  for (int i = 0; i < 20; ++i) {
+    children.push_back(js_context.CreateObject(JSExport<PooledChild>::Class()));
+  }
+  
+  for (const auto& child : children) {
+    XCTAssertNotEqual(nullptr, child.GetPrivate<PooledChild>());
+  }
+  
+  const auto after = JSExportAllocator<PooledParent>::GetStatistics();
+  XCTAssertEqual(before.total_allocations + 20, after.total_allocations);
+  XCTAssertEqual(before.in_use, after.in_use);
+  XCTAssertEqual(before_count + 20, PooledParent::live_count);
+  
+  // The replaced objects' slots were reused, so 20 objects didn't
+  // need more than one slab beyond what the pool already had.
+  XCTAssertTrue(after.slab_count <= before.slab_count + 1);
+}
+
+TEST_F(JSExportTests, NativeFunctionSignatures) {
+  JSContext js_context = js_context_group.CreateContext();
+  JSObject global_object = js_context.get_global_object();
+  global_object.SetProperty("widget", js_context.CreateObject(JSExport<Widget>::Class()));
+  
+  JSValue result = js_context.JSEvaluateScript("widget.scaleNumber(0.5);");
+  XCTAssertTrue(result.IsNumber());
+  XCTAssertEqual(21, static_cast<double>(result));
+  
+  result = js_context.JSEvaluateScript("widget.greet('Hello', '2', 'ignored');");
+  XCTAssertTrue(result.IsString());
+  XCTAssertEqual("Hello world, Hello world", static_cast<std::string>(result));
+  
+  result = js_context.JSEvaluateScript("widget.rename('foo');");
+  XCTAssertTrue(result.IsUndefined());
+  XCTAssertEqual("foo", static_cast<std::string>(js_context.JSEvaluateScript("widget.name;")));
+  
+  // Too few arguments throw a JavaScript exception.
+  result = js_context.JSEvaluateScript("var threw = false; try { widget.greet('Hello'); } catch (e) { threw = true; } threw;");
+  XCTAssertTrue(static_cast<bool>(result));
+}
+
 TEST_F(JSExportTests, JSExport) {
   JSContext js_context = js_context_group.CreateContext();
   JSObject global_object   = js_context.get_global_object();
@@ -1209,6 +1632,20 @@ TEST_F(JSExportTests, JSExportPostConstruct) {
   XCTAssertTrue(result.IsUndefined());
 }
 
+TEST_F(JSExportTests, JSArgumentsCallAsFunctionAndConstructor) {
+  JSContext js_context = js_context_group.CreateContext();
+  JSObject global_object = js_context.get_global_object();
+  JSObject other_widget = js_context.CreateObject(JSExport<OtherWidget>::Class());
+  global_object.SetProperty("OtherWidget", other_widget);
+  
+  XCTAssertTrue(other_widget.IsFunction());
+  XCTAssertEqual(0, static_cast<int32_t>(js_context.JSEvaluateScript("OtherWidget();")));
+  XCTAssertEqual(3, static_cast<int32_t>(js_context.JSEvaluateScript("OtherWidget(1, 'two', {});")));
+  
+  XCTAssertTrue(js_context.JSEvaluateScript("OtherWidget.constructor_argument_count;").IsUndefined());
+  XCTAssertEqual(2, static_cast<int32_t>(js_context.JSEvaluateScript("new OtherWidget('foo', 123).constructor_argument_count;")));
+}
+
 TEST_F(JSExportTests, JSExportPostConstructForNewObject) {
   JSContext js_context = js_context_group.CreateContext();
   JSObject global_object = js_context.get_global_object();
@@ -1281,3 +1718,31 @@ TEST_F(JSExportTests, ExceptionCall2) {
     XCTAssertEqual(2, e.js_stack().size());
   }
 }
+
+TEST_F(JSExportTests, JSVectorView) {
+  JSContext js_context = js_context_group.CreateContext();
+  JSObject global_object = js_context.get_global_object();
+  
+  std::vector<double> samples { 1.5, 2.5, 3.5 };
+  global_object.SetProperty("samples", JSVectorView<double>::Create(js_context, samples));
+  
+  XCTAssertEqual(3, static_cast<int32_t>(js_context.JSEvaluateScript("samples.length")));
+  XCTAssertEqual(2.5, static_cast<double>(js_context.JSEvaluateScript("samples[1]")));
+  XCTAssertTrue(static_cast<bool>(js_context.JSEvaluateScript("2 in samples")));
+  XCTAssertFalse(static_cast<bool>(js_context.JSEvaluateScript("3 in samples")));
+  XCTAssertTrue(js_context.JSEvaluateScript("samples[3]").IsUndefined());
+  XCTAssertEqual(7.5, static_cast<double>(js_context.JSEvaluateScript("var sum = 0; for (var i = 0; i < samples.length; ++i) { sum += samples[i]; } sum")));
+  
+  // Writes go straight to the vector, and native changes are visible
+  // to JavaScript.
+  js_context.JSEvaluateScript("samples[0] = 42");
+  XCTAssertEqual(42, samples[0]);
+  samples.push_back(4.5);
+  XCTAssertEqual(4, static_cast<int32_t>(js_context.JSEvaluateScript("samples.length")));
+  
+  std::vector<std::string> names { "a", "b" };
+  global_object.SetProperty("names", JSVectorView<std::string>::Create(js_context, names));
+  XCTAssertEqual("a,b", static_cast<std::string>(js_context.JSEvaluateScript("var s = []; for (var k in names) { s.push(names[k]); } s.join()")));
+  js_context.JSEvaluateScript("names[1] = 'c'");
+  XCTAssertEqual("c", names[1]);
+}
@@ -10,6 +10,10 @@
 
 #include "gtest/gtest.h"
 
+#include <cstdio>
+#include <fstream>
+#include <numeric>
+
 #define XCTAssertEqual    ASSERT_EQ
 #define XCTAssertNotEqual ASSERT_NE
 #define XCTAssertTrue     ASSERT_TRUE
@@ -57,6 +61,34 @@ TEST_F(JSObjectTests, JSPropertyAttribute) {
   XCTAssertEqual(1, attributes.size());
 }
 
+TEST_F(JSObjectTests, JSPropertyAttributeSet) {
+  JSPropertyAttributeSet attributes;
+  XCTAssertTrue(attributes.empty());
+  XCTAssertEqual(1, attributes.count(JSPropertyAttribute::None));
+  XCTAssertEqual(0, attributes.count(JSPropertyAttribute::ReadOnly));
+  XCTAssertEqual(0u, detail::ToJSPropertyAttributes(attributes));
+  
+  XCTAssertTrue(attributes.insert(JSPropertyAttribute::DontDelete));
+  XCTAssertFalse(attributes.insert(JSPropertyAttribute::DontDelete));
+  XCTAssertEqual(0, attributes.count(JSPropertyAttribute::None));
+  XCTAssertEqual(1, attributes.count(JSPropertyAttribute::DontDelete));
+  XCTAssertEqual(static_cast<unsigned>(kJSPropertyAttributeDontDelete), detail::ToJSPropertyAttributes(attributes));
+  
+  attributes |= JSPropertyAttribute::ReadOnly;
+  XCTAssertTrue(attributes == (JSPropertyAttribute::ReadOnly | JSPropertyAttribute::DontDelete));
+  XCTAssertTrue(attributes == JSPropertyAttributeSet({JSPropertyAttribute::DontDelete, JSPropertyAttribute::ReadOnly}));
+  XCTAssertTrue(attributes == detail::FromJSPropertyAttributes(kJSPropertyAttributeReadOnly | kJSPropertyAttributeDontDelete));
+  XCTAssertEqual("ReadOnly, DontDelete", detail::to_string(attributes));
+  
+  XCTAssertEqual(1, attributes.erase(JSPropertyAttribute::ReadOnly));
+  XCTAssertEqual(0, attributes.erase(JSPropertyAttribute::ReadOnly));
+  XCTAssertTrue(attributes == JSPropertyAttribute::DontDelete);
+  
+  // A std::unordered_set still converts for source compatibility.
+  const std::unordered_set<JSPropertyAttribute> attribute_set { JSPropertyAttribute::DontEnum };
+  XCTAssertTrue(JSPropertyAttributeSet(attribute_set) == JSPropertyAttribute::DontEnum);
+}
+
 TEST_F(JSObjectTests, API) {
   JSContext js_context = js_context_group.CreateContext();
   JSObject js_object = js_context.CreateObject();
@@ -369,3 +401,405 @@ TEST_F(JSObjectTests, JSFunction) {
   XCTAssertFalse(js_function.IsArray());
   XCTAssertFalse(js_function.IsError());
 }
+
+TEST_F(JSObjectTests, Identity) {
+  JSContext js_context = js_context_group.CreateContext();
+  JSObject js_object_1 = js_context.CreateObject();
+  JSObject js_object_2 = js_context.CreateObject();
+  JSObject js_object_3 = js_object_1;
+  
+  XCTAssertTrue(js_object_1 == js_object_3);
+  XCTAssertTrue(js_object_1 != js_object_2);
+  XCTAssertEqual(std::hash<JSObject>()(js_object_1), std::hash<JSObject>()(js_object_3));
+  
+  std::unordered_map<JSObject, int> objects;
+  objects.emplace(js_object_1, 1);
+  objects.emplace(js_object_2, 2);
+  XCTAssertEqual(2, objects.size());
+  XCTAssertEqual(1, objects.at(js_object_3));
+  
+  // Strings with equal contents are === but not identical.
+  JSValue js_value_1 = js_context.CreateString("foo");
+  JSValue js_value_2 = js_context.CreateString("foo");
+  XCTAssertTrue(js_value_1 == js_value_2);
+  XCTAssertTrue(js_value_1.IsIdenticalTo(js_value_1));
+  XCTAssertFalse(js_value_1.IsIdenticalTo(js_context.CreateString("bar")));
+  
+  std::unordered_set<JSValue, JSValueIdentityHash, JSValueIdentityEqual> values;
+  values.insert(js_value_1);
+  values.insert(js_value_1);
+  XCTAssertEqual(1, values.size());
+}
+
+TEST_F(JSObjectTests, JSWeakMap) {
+  JSContext js_context = js_context_group.CreateContext();
+  JSWeakMap<std::string> weak_map;
+  
+  JSObject js_object = js_context.CreateObject();
+  XCTAssertTrue(weak_map.empty());
+  XCTAssertEqual(nullptr, weak_map.Find(js_object));
+  XCTAssertTrue(weak_map.Set(js_object, "first"));
+  XCTAssertFalse(weak_map.Set(js_object, "second"));
+  XCTAssertEqual(1, weak_map.size());
+  XCTAssertEqual("second", *weak_map.Find(js_object));
+  
+  // The sentinel property is not enumerable.
+  XCTAssertEqual(0, static_cast<std::vector<JSString>>(js_object.GetPropertyNames()).size());
+  
+  XCTAssertTrue(weak_map.Erase(js_object));
+  XCTAssertFalse(weak_map.Erase(js_object));
+  XCTAssertFalse(weak_map.Contains(js_object));
+  
+  auto frozen = static_cast<JSObject>(js_context.JSEvaluateScript("Object.freeze({})"));
+  ASSERT_THROW(weak_map.Set(frozen, "frozen"), std::invalid_argument);
+  
+  // Entries go away when their keys are collected, and an entry
+  // whose key is still held survives.
+  JSObject held = js_context.CreateObject();
+  XCTAssertTrue(weak_map.Set(held, "held"));
+  for (int i = 0; i < 1000; ++i) {
+    weak_map.Set(js_context.CreateObject(), "garbage");
+  }
+  js_context.GarbageCollect();
+  XCTAssertTrue(weak_map.size() < 1001);
+  XCTAssertTrue(weak_map.Contains(held));
+  XCTAssertEqual("held", *weak_map.Find(held));
+  
+  weak_map.Set(js_object, "alive");
+  XCTAssertEqual("alive", *weak_map.Find(js_object));
+}
+
+TEST_F(JSObjectTests, TryAPIs) {
+  JSContext js_context = js_context_group.CreateContext();
+  JSObject js_object = js_context.CreateObject();
+  
+  XCTAssertTrue(js_object.TrySetProperty("foo", js_context.CreateNumber(42)).has_value());
+  auto foo = js_object.TryGetProperty("foo");
+  XCTAssertTrue(foo.has_value());
+  XCTAssertEqual(42, static_cast<int32_t>(*foo));
+  
+  auto thrower = static_cast<JSObject>(js_context.JSEvaluateScript("({ get bar() { throw new TypeError('no bar'); } })"));
+  auto bar = thrower.TryGetProperty("bar");
+  XCTAssertFalse(bar.has_value());
+  XCTAssertFalse(bar.error().IsNative());
+  XCTAssertEqual("TypeError: no bar", bar.error().message());
+  ASSERT_THROW(bar.value(), std::runtime_error);
+  XCTAssertEqual(1, static_cast<int32_t>(bar.value_or(js_context.CreateNumber(1))));
+  
+  auto result = js_object.TryCallAsFunction({}, js_object);
+  XCTAssertFalse(result.has_value());
+  XCTAssertTrue(result.error().IsNative());
+  XCTAssertEqual("This JavaScript object is not a function.", result.error().message());
+  
+  auto script_result = js_context.TryJSEvaluateScript("1 +");
+  XCTAssertFalse(script_result.has_value());
+  XCTAssertTrue(script_result.error().get_value().IsObject());
+  XCTAssertEqual(3, static_cast<int32_t>(*js_context.TryJSEvaluateScript("1 + 2")));
+  
+  auto to_primitive_thrower = js_context.JSEvaluateScript("({ valueOf: function() { throw new Error('no number'); } })");
+  XCTAssertFalse(to_primitive_thrower.TryToNumber().has_value());
+  XCTAssertFalse(to_primitive_thrower.TryToInt32().has_value());
+  XCTAssertEqual(7, *js_context.CreateNumber(7.5).TryToInt32());
+  XCTAssertFalse(js_context.CreateUndefined().TryToObject().has_value());
+  XCTAssertEqual("hello", static_cast<std::string>(*js_context.CreateString("hello").TryToString()));
+}
+
+TEST_F(JSObjectTests, JSTypedArray) {
+  JSContext js_context = js_context_group.CreateContext();
+  
+  // Native memory is shared with JavaScript, not copied.
+  std::vector<float> samples { 0.5f, 1.5f, 2.5f };
+  auto js_samples = js_context.CreateTypedArray(std::move(samples));
+  XCTAssertEqual(3, js_samples.size());
+  XCTAssertTrue(js_samples.IsTypedArray());
+  XCTAssertFalse(js_samples.IsArrayBuffer());
+  js_samples[1] = 42.0f;
+  js_context.get_global_object().SetProperty("samples", js_samples);
+  XCTAssertEqual(42, static_cast<int32_t>(js_context.JSEvaluateScript("samples[1]")));
+  js_context.JSEvaluateScript("samples[2] = 7;");
+  XCTAssertEqual(7.0f, js_samples[2]);
+  
+  auto bytes = new std::uint8_t[4] { 1, 2, 3, 4 };
+  {
+    auto js_array_buffer = js_context.CreateArrayBuffer(bytes, 4, [](void* bytes) {
+      delete[] static_cast<std::uint8_t*>(bytes);
+    });
+    XCTAssertTrue(js_array_buffer.IsArrayBuffer());
+    XCTAssertEqual(4, js_array_buffer.size());
+    XCTAssertEqual(bytes, js_array_buffer.data());
+    
+    auto js_view = js_context.CreateTypedArray<std::uint16_t>(js_array_buffer, 2, 1);
+    XCTAssertEqual(2, js_view.GetByteOffset());
+    XCTAssertEqual(bytes + 2, reinterpret_cast<std::uint8_t*>(js_view.data()));
+    XCTAssertEqual(bytes, js_view.GetBuffer().data());
+  }
+  
+  // Typed arrays round trip through JSObject and are type checked.
+  auto js_object = static_cast<JSObject>(js_context.JSEvaluateScript("new Int32Array([1, 2, 3])"));
+  auto js_int32_array = static_cast<JSTypedArray<std::int32_t>>(js_object);
+  XCTAssertEqual(6, std::accumulate(js_int32_array.begin(), js_int32_array.end(), 0));
+  ASSERT_THROW(static_cast<JSTypedArray<double>>(js_object), std::invalid_argument);
+  ASSERT_THROW(static_cast<JSArrayBuffer>(js_object), std::invalid_argument);
+  
+  auto js_zeros = js_context.CreateArrayBuffer(16);
+  XCTAssertEqual(16, js_zeros.size());
+  XCTAssertEqual(0, std::accumulate(js_zeros.begin(), js_zeros.end(), 0));
+}
+
+TEST_F(JSObjectTests, JSSharedBuffer) {
+  JSSharedBuffer js_shared_buffer(std::vector<std::uint8_t> { 10, 20, 30, 40 });
+  XCTAssertEqual(1, js_shared_buffer.use_count());
+  
+  JSContextGroup other_js_context_group;
+  JSContext js_context_1 = js_context_group.CreateContext();
+  JSContext js_context_2 = other_js_context_group.CreateContext();
+  
+  auto js_array_buffer_1 = js_context_1.CreateArrayBuffer(js_shared_buffer);
+  auto js_array_buffer_2 = js_context_2.CreateArrayBuffer(js_shared_buffer);
+  XCTAssertEqual(3, js_shared_buffer.use_count());
+  
+  // Both groups see the same memory.
+  XCTAssertEqual(js_shared_buffer.data(), js_array_buffer_1.data());
+  XCTAssertEqual(js_shared_buffer.data(), js_array_buffer_2.data());
+  
+  js_context_2.get_global_object().SetProperty("table", js_context_2.CreateTypedArray<std::uint8_t>(js_array_buffer_2, 0, 4));
+  XCTAssertEqual(100, static_cast<int32_t>(js_context_2.JSEvaluateScript("table.reduce(function(a, b) { return a + b; }, 0)")));
+}
+
+TEST_F(JSObjectTests, CreateArrayBufferFromFile) {
+  JSContext js_context = js_context_group.CreateContext();
+  
+  const std::string path = "JSObjectTests_CreateArrayBufferFromFile.bin";
+  const std::int32_t values[] = { 1, 2, 3, 4 };
+  {
+    std::ofstream file(path, std::ios::binary);
+    file.write(reinterpret_cast<const char*>(values), sizeof(values));
+  }
+  
+  auto js_array_buffer = js_context.CreateArrayBufferFromFile(path);
+  XCTAssertEqual(sizeof(values), js_array_buffer.size());
+  
+  auto js_int32_array = js_context.CreateTypedArrayFromFile<std::int32_t>(path);
+  XCTAssertEqual(4, js_int32_array.size());
+  XCTAssertEqual(10, std::accumulate(js_int32_array.begin(), js_int32_array.end(), 0));
+  
+  // Writes from JavaScript never reach the file.
+  js_context.get_global_object().SetProperty("values", js_int32_array);
+  js_context.JSEvaluateScript("values[0] = 100;");
+  XCTAssertEqual(100, js_int32_array[0]);
+  XCTAssertEqual(1, js_context.CreateTypedArrayFromFile<std::int32_t>(path)[0]);
+  
+  ASSERT_THROW(js_context.CreateTypedArrayFromFile<double>(path + ".missing"), std::runtime_error);
+  std::remove(path.c_str());
+}
+
+TEST_F(JSObjectTests, CreateArrayFromRange) {
+  JSContext js_context = js_context_group.CreateContext();
+  auto global_object = js_context.get_global_object();
+  
+  const std::vector<double> numbers { 1.5, 2.5, 3.0 };
+  global_object.SetProperty("numbers", js_context.CreateArray(numbers));
+  XCTAssertEqual(7.0, static_cast<double>(js_context.JSEvaluateScript("numbers.reduce(function(a, b) { return a + b; }, 0)")));
+  
+  const int integers[] = { 1, 2, 3, 4 };
+  global_object.SetProperty("integers", js_context.CreateArray(std::begin(integers), std::end(integers)));
+  XCTAssertEqual(4, static_cast<int32_t>(js_context.JSEvaluateScript("integers.length")));
+  XCTAssertTrue(static_cast<bool>(js_context.JSEvaluateScript("typeof integers[3] === 'number' && integers[3] === 4")));
+  
+  const std::vector<std::string> strings { "hello", "", "world" };
+  global_object.SetProperty("strings", js_context.CreateArray(strings));
+  js_context.GarbageCollect();
+  XCTAssertEqual("hello,,world", static_cast<std::string>(js_context.JSEvaluateScript("strings.join()")));
+  
+  const std::vector<JSString> js_strings { "a", "b" };
+  global_object.SetProperty("js_strings", js_context.CreateArray(js_strings));
+  XCTAssertEqual("ab", static_cast<std::string>(js_context.JSEvaluateScript("js_strings.join('')")));
+  
+  const std::vector<bool> booleans { true, false };
+  global_object.SetProperty("booleans", js_context.CreateArray(booleans));
+  XCTAssertTrue(static_cast<bool>(js_context.JSEvaluateScript("booleans[0] === true && booleans[1] === false")));
+  
+  const std::vector<double> empty;
+  XCTAssertEqual(0, js_context.CreateArray(empty).GetLength());
+}
+
+TEST_F(JSObjectTests, JSArrayFastPaths) {
+  JSContext js_context = js_context_group.CreateContext();
+  JSArray js_array = static_cast<JSArray>(static_cast<JSObject>(js_context.JSEvaluateScript("[1, 'two', 3, null]")));
+  XCTAssertEqual(4, js_array.GetLength());
+  
+  std::vector<JSValue> values;
+  XCTAssertEqual(2, js_array.GetRange(1, 3, values));
+  XCTAssertEqual(2, values.size());
+  XCTAssertEqual("two", static_cast<std::string>(values.at(0)));
+  XCTAssertEqual(3, static_cast<int32_t>(values.at(1)));
+  
+  // The range is clamped to the length.
+  XCTAssertEqual(1, js_array.GetRange(3, 100, values));
+  XCTAssertTrue(values.at(0).IsNull());
+  XCTAssertEqual(0, js_array.GetRange(5, 10, values));
+  XCTAssertTrue(values.empty());
+  
+  std::size_t count = 0;
+  std::size_t numbers = 0;
+  for (const auto js_value_view : js_array) {
+    ++count;
+    if (js_value_view.IsNumber()) {
+      ++numbers;
+    }
+  }
+  XCTAssertEqual(4, count);
+  XCTAssertEqual(2, numbers);
+  
+  const JSValue first = *js_array.begin();
+  XCTAssertEqual(1, static_cast<int32_t>(first));
+  
+  js_array.Append(std::vector<double> { 5, 6 });
+  js_array.Append({ js_context.CreateString("seven") });
+  const std::vector<std::string> strings { "eight", "nine" };
+  js_array.Append(strings.begin(), strings.end());
+  XCTAssertEqual(9, js_array.GetLength());
+  
+  js_context.get_global_object().SetProperty("array", js_array);
+  XCTAssertEqual("1,two,3,,5,6,seven,eight,nine", static_cast<std::string>(js_context.JSEvaluateScript("array.join()")));
+  
+  // A copy of an Array built from its own iterators.
+  const auto js_copy = js_context.CreateArray(js_array.begin(), js_array.end());
+  XCTAssertEqual(9, js_copy.GetLength());
+}
+
+TEST_F(JSObjectTests, ForEachProperty) {
+  JSContext js_context = js_context_group.CreateContext();
+  const auto js_object = static_cast<JSObject>(js_context.JSEvaluateScript("({ 'a': 1, 'b': 'two', 'caf\\u00e9': true })"));
+  
+  std::vector<std::string> names;
+  std::size_t numbers = 0;
+  js_object.ForEachProperty([&](const JSStringView& property_name, const JSValueView& property_value) {
+    names.push_back(to_string(property_name));
+    if (property_value.IsNumber()) {
+      ++numbers;
+      XCTAssertTrue(property_name == "a");
+      XCTAssertEqual(1, static_cast<int32_t>(property_value));
+    }
+  });
+  XCTAssertEqual(3, names.size());
+  XCTAssertEqual("café", names.at(2));
+  XCTAssertEqual(1, numbers);
+  
+  std::size_t count = 0;
+  for (const auto property_name : js_object.GetPropertyNames()) {
+    XCTAssertFalse(property_name.empty());
+    if (property_name == JSString("b")) {
+      XCTAssertEqual("two", static_cast<std::string>(js_object.GetProperty(property_name)));
+    }
+    ++count;
+  }
+  XCTAssertEqual(3, count);
+}
+
+TEST_F(JSObjectTests, BatchedProperties) {
+  JSContext js_context = js_context_group.CreateContext();
+  
+  // The keys are created once and reused for every object.
+  const std::vector<JSString> keys { "id", "name", "active" };
+  
+  auto js_object = js_context.CreateObject();
+  js_object.SetProperties({
+    { keys.at(0), js_context.CreateNumber(7) },
+    { keys.at(1), js_context.CreateString("seven") },
+    { keys.at(2), js_context.CreateBoolean(true) }
+  });
+  
+  const auto values = js_object.GetProperties(std::vector<JSString> { "name", "id", "missing" });
+  XCTAssertEqual(3, values.size());
+  XCTAssertEqual("seven", static_cast<std::string>(values.at(0)));
+  XCTAssertEqual(7, static_cast<int32_t>(values.at(1)));
+  XCTAssertTrue(values.at(2).IsUndefined());
+  
+  js_object.SetProperties({ { "frozen", js_context.CreateNumber(1) } }, { JSPropertyAttribute::ReadOnly });
+  js_object.SetProperty("frozen", js_context.CreateNumber(2));
+  XCTAssertEqual(1, static_cast<int32_t>(js_object.GetProperty("frozen")));
+  
+  // The first exception stops the batch.
+  auto js_setter = static_cast<JSObject>(js_context.JSEvaluateScript("({ set bad(value) { throw new Error('bad'); } })"));
+  ASSERT_THROW(js_setter.SetProperties({ { "bad", js_context.CreateNumber(1) }, { "after", js_context.CreateNumber(2) } }), std::runtime_error);
+  XCTAssertFalse(js_setter.HasProperty("after"));
+  
+  // A range of references sets the names and values in place.
+  const std::vector<JSValue> row { js_context.CreateNumber(8), js_context.CreateString("eight"), js_context.CreateBoolean(false) };
+  std::vector<std::pair<std::reference_wrapper<const JSString>, std::reference_wrapper<const JSValue>>> properties;
+  for (std::size_t i = 0; i < keys.size(); ++i) {
+    properties.emplace_back(std::cref(keys.at(i)), std::cref(row.at(i)));
+  }
+  
+  auto js_row = js_context.CreateObject();
+  js_row.SetProperties(properties.begin(), properties.end());
+  XCTAssertEqual(8, static_cast<int32_t>(js_row.GetProperty("id")));
+  XCTAssertEqual("eight", static_cast<std::string>(js_row.GetProperty("name")));
+  XCTAssertFalse(static_cast<bool>(js_row.GetProperty("active")));
+  
+  js_row.SetProperties(properties.begin(), properties.begin() + 1, { JSPropertyAttribute::ReadOnly });
+  js_row.SetProperty("id", js_context.CreateNumber(9));
+  XCTAssertEqual(8, static_cast<int32_t>(js_row.GetProperty("id")));
+}
+
+namespace {
+  struct ResultRow {
+    int         id;
+    std::string name;
+    bool        active;
+  };
+}
+
+TEST_F(JSObjectTests, JSObjectTemplate) {
+  JSContext js_context = js_context_group.CreateContext();
+  
+  auto js_template = js_context.CreateObjectTemplate({ "id", "name", "quote\"d" });
+  XCTAssertEqual(3, js_template.size());
+  
+  auto js_object = js_template.Instantiate({ js_context.CreateNumber(1), js_context.CreateString("one"), js_context.CreateBoolean(true) });
+  XCTAssertEqual(1, static_cast<int32_t>(js_object.GetProperty("id")));
+  XCTAssertEqual("one", static_cast<std::string>(js_object.GetProperty("name")));
+  XCTAssertTrue(static_cast<bool>(js_object.GetProperty("quote\"d")));
+  ASSERT_THROW(js_template.Instantiate({ js_context.CreateNumber(1) }), std::invalid_argument);
+  
+  JSObjectFieldDescriptor<ResultRow> fields;
+  fields
+  .AddField("id"    , &ResultRow::id)
+  .AddField("name"  , &ResultRow::name)
+  .AddField("active", &ResultRow::active)
+  .AddField("label" , [](const JSContext& js_context, const ResultRow& row) { return js_context.CreateString(row.name + "#" + std::to_string(row.id)); });
+  
+  const std::vector<ResultRow> rows { { 1, "one", true }, { 2, "two", false } };
+  auto js_rows_template = js_context.CreateObjectTemplate(fields.get_property_names());
+  JSArray js_rows = js_rows_template.Instantiate(rows, fields);
+  XCTAssertEqual(2, js_rows.GetLength());
+  
+  auto js_row = static_cast<JSObject>(js_rows.GetProperty(1));
+  XCTAssertEqual(2, static_cast<int32_t>(js_row.GetProperty("id")));
+  XCTAssertEqual("two", static_cast<std::string>(js_row.GetProperty("name")));
+  XCTAssertFalse(static_cast<bool>(js_row.GetProperty("active")));
+  XCTAssertEqual("two#2", static_cast<std::string>(js_row.GetProperty("label")));
+  
+  ASSERT_THROW(js_template.Instantiate(rows, fields), std::invalid_argument);
+}
+
+TEST_F(JSObjectTests, JSObjectTemplateFallback) {
+  JSContext js_context = js_context_group.CreateContext();
+  
+  // An object literal that repeats "__proto__" is a SyntaxError, so
+  // this template sets its properties one at a time.
+  auto js_template = js_context.CreateObjectTemplate({ "id", "__proto__", "__proto__" });
+  XCTAssertEqual(3, js_template.size());
+  
+  JSObject first_prototype  = js_context.CreateObject();
+  JSObject second_prototype = js_context.CreateObject();
+  second_prototype.SetProperty("kind", js_context.CreateString("second"));
+  
+  for (int32_t i = 0; i < 2; ++i) {
+    auto js_object = js_template.Instantiate({ js_context.CreateNumber(i), first_prototype, second_prototype });
+    XCTAssertEqual(i, static_cast<int32_t>(js_object.GetProperty("id")));
+    XCTAssertEqual("second", static_cast<std::string>(js_object.GetProperty("kind")));
+    XCTAssertTrue(js_object.GetPrototype() == static_cast<JSValue>(second_prototype));
+  }
+}
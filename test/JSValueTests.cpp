@@ -7,6 +7,7 @@
  */
 
 #include "HAL/HAL.hpp"
+#include <sstream>
 
 #include "gtest/gtest.h"
 
@@ -186,6 +187,33 @@ TEST_F(JSValueTests, ToJSONString) {
   XCTAssertEqual("42", js_uint32_sjon);
 }
 
+TEST_F(JSValueTests, WriteJSON) {
+  JSContext js_context = js_context_group.CreateContext();
+  
+  std::string json;
+  JSONStringSink string_sink(json);
+  XCTAssertFalse(js_context.CreateUndefined().WriteJSON(string_sink));
+  XCTAssertTrue(json.empty());
+  
+  JSValue js_value = js_context.JSEvaluateScript("({ \"name\" : \"caf\\u00e9 \\ud83d\\ude00\", \"list\" : [1, 2] })");
+  XCTAssertTrue(js_value.WriteJSON(string_sink));
+  XCTAssertEqual(static_cast<std::string>(js_value.ToJSONString()), json);
+  
+  std::ostringstream ostream;
+  JSONStreamSink stream_sink(ostream);
+  XCTAssertTrue(js_value.WriteJSON(stream_sink, 2));
+  XCTAssertEqual(static_cast<std::string>(js_value.ToJSONString(2)), ostream.str());
+  
+  // Output larger than one chunk is split across several writes.
+  js_value = js_context.JSEvaluateScript("new Array(5000).join('x')");
+  json.clear();
+  XCTAssertTrue(js_value.WriteJSON(string_sink));
+  XCTAssertEqual(5001, json.size());
+  
+  js_value = js_context.JSEvaluateScript("var o = {}; o.self = o; o");
+  ASSERT_THROW(js_value.WriteJSON(string_sink), std::runtime_error);
+}
+
 TEST_F(JSValueTests, String) {
   JSContext js_context = js_context_group.CreateContext();
   JSValue js_value = js_context.CreateString("hello, world");